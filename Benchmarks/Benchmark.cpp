@@ -0,0 +1,250 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <new>
+
+#include <Common/Debug.h>
+
+#include <Common/Utils/FileUtils.h>
+
+#include <Benchmarks/Benchmark.h>
+
+#include <Vendor/rapidjson/rapidjson.h>
+#include <Vendor/rapidjson/prettywriter.h>
+#include <Vendor/rapidjson/stringbuffer.h>
+
+///////////////////////////////////////////////////////////
+// Namespaces
+///////////////////////////////////////////////////////////
+
+namespace rj = rapidjson;
+
+///////////////////////////////////////////////////////////
+// Globals
+///////////////////////////////////////////////////////////
+
+std::atomic<ark::U64> gAllocationCount = 0;
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+static constexpr const char* sOptions[] = { "--filter", "--output", "--min-time", "--min-iterations" };
+
+static void PrintUsage()
+{
+  LOG("Usage: Benchmarks [--filter <text>] [--output <file>] [--min-time <seconds>] [--min-iterations <count>]\n");
+}
+
+///////////////////////////////////////////////////////////
+// Allocation Hooks
+///////////////////////////////////////////////////////////
+
+void* operator new(std::size_t Size)
+{
+  gAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+  if (void* pointer = std::malloc(Size ? Size : 1))
+  {
+    return pointer;
+  }
+
+  throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t Size)
+{
+  return operator new(Size);
+}
+
+void operator delete(void* Pointer) noexcept
+{
+  std::free(Pointer);
+}
+
+void operator delete[](void* Pointer) noexcept
+{
+  std::free(Pointer);
+}
+
+void operator delete(void* Pointer, std::size_t) noexcept
+{
+  std::free(Pointer);
+}
+
+void operator delete[](void* Pointer, std::size_t) noexcept
+{
+  std::free(Pointer);
+}
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  BenchmarkState::BenchmarkState(R64 MinTime, U64 MinIterations)
+    : mMinTime{ MinTime }
+    , mMinIterations{ MinIterations }
+  {
+
+  }
+
+  bool BenchmarkState::Next()
+  {
+    if (mIterations == 0)
+    {
+      mAllocations = gAllocationCount.load(std::memory_order_relaxed);
+      mBegin = std::chrono::steady_clock::now();
+    }
+    else
+    {
+      mElapsed = std::chrono::duration<R64>(std::chrono::steady_clock::now() - mBegin).count();
+
+      if (mElapsed >= mMinTime && mIterations >= mMinIterations)
+      {
+        mAllocations = gAllocationCount.load(std::memory_order_relaxed) - mAllocations;
+
+        return false;
+      }
+    }
+
+    mIterations++;
+
+    return true;
+  }
+
+  Benchmark::Benchmark(const char* Name, std::function<void(BenchmarkState&)> Function)
+    : mName{ Name }
+    , mFunction{ std::move(Function) }
+  {
+    GetBenchmarks().emplace_back(this);
+  }
+
+  std::vector<Benchmark*>& Benchmark::GetBenchmarks()
+  {
+    static std::vector<Benchmark*> sBenchmarks = {};
+
+    return sBenchmarks;
+  }
+
+  BenchmarkResult Benchmark::Run(R64 MinTime, U64 MinIterations)
+  {
+    BenchmarkState state = { MinTime, MinIterations };
+
+    mFunction(state);
+
+    U64 iterations = state.GetIterations();
+
+    BenchmarkResult result = {};
+
+    result.Name = mName;
+    result.Iterations = iterations;
+    result.NanoSecondsPerOp = iterations ? (state.GetElapsed() * 1.0E9) / iterations : 0.0;
+    result.BytesPerSecond = (state.GetElapsed() > 0.0) ? ((R64)state.GetBytesPerOp() * iterations) / state.GetElapsed() : 0.0;
+    result.AllocationsPerOp = iterations ? (R64)state.GetAllocations() / iterations : 0.0;
+
+    return result;
+  }
+}
+
+///////////////////////////////////////////////////////////
+// Entry Point
+///////////////////////////////////////////////////////////
+
+ark::I32 main(ark::I32 Argc, char** Argv)
+{
+  std::string filter = {};
+  std::string outputFile = {};
+  ark::R64 minTime = 0.5;
+  ark::U64 minIterations = 8;
+
+  for (ark::I32 i = 1; i < Argc; i++)
+  {
+    const char* option = Argv[i];
+    const char* value = ((i + 1) < Argc) ? Argv[i + 1] : nullptr;
+
+    if (std::strcmp(option, "--help") == 0)
+    {
+      PrintUsage();
+
+      return 0;
+    }
+
+    // Options are matched before their value is required, so unknown ones get the usage
+
+    if (std::none_of(std::begin(sOptions), std::end(sOptions), [&](const char* Name) { return std::strcmp(option, Name) == 0; }))
+    {
+      LOG("Unknown option %s\n", option);
+
+      PrintUsage();
+
+      return 2;
+    }
+
+    if (!value)
+    {
+      LOG("Missing value for %s\n", option);
+
+      return 2;
+    }
+
+    if (std::strcmp(option, "--filter") == 0) filter = value;
+    else if (std::strcmp(option, "--output") == 0) outputFile = value;
+    else if (std::strcmp(option, "--min-time") == 0) minTime = std::strtod(value, nullptr);
+    else if (std::strcmp(option, "--min-iterations") == 0) minIterations = std::strtoull(value, nullptr, 10);
+
+    i++;
+  }
+
+  rj::StringBuffer buffer;
+  rj::PrettyWriter<rj::StringBuffer> writer = rj::PrettyWriter<rj::StringBuffer>{ buffer };
+
+  writer.StartObject();
+  writer.Key("benchmarks");
+  writer.StartArray();
+
+  for (auto benchmark : ark::Benchmark::GetBenchmarks())
+  {
+    if (std::string{ benchmark->GetName() }.find(filter) == std::string::npos)
+    {
+      continue;
+    }
+
+    ark::BenchmarkResult result = benchmark->Run(minTime, minIterations);
+
+    writer.StartObject();
+    writer.Key("name"); writer.String(result.Name.c_str());
+    writer.Key("iterations"); writer.Uint64(result.Iterations);
+    writer.Key("nsPerOp"); writer.Double(result.NanoSecondsPerOp);
+    writer.Key("opsPerSecond"); writer.Double((result.NanoSecondsPerOp > 0.0) ? 1.0E9 / result.NanoSecondsPerOp : 0.0);
+    writer.Key("mbPerSecond"); writer.Double(result.BytesPerSecond / (1024.0 * 1024.0));
+    writer.Key("allocationsPerOp"); writer.Double(result.AllocationsPerOp);
+    writer.EndObject();
+
+    if (!outputFile.empty())
+    {
+      LOG("%-40s %12.1f ns/op %10.1f MB/s %8.2f allocs/op\n", result.Name.c_str(), result.NanoSecondsPerOp, result.BytesPerSecond / (1024.0 * 1024.0), result.AllocationsPerOp);
+
+      // The log thread must not allocate while the next benchmark counts allocations
+
+      ark::Logger::Flush();
+    }
+  }
+
+  writer.EndArray();
+  writer.EndObject();
+
+  if (outputFile.empty())
+  {
+    std::printf("%s\n", buffer.GetString());
+  }
+  else
+  {
+    ark::FileUtils::WriteText(outputFile, buffer.GetString());
+  }
+
+  return 0;
+}
\ No newline at end of file
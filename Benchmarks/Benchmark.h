@@ -0,0 +1,116 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <functional>
+
+#include <Common/Platform.h>
+#include <Common/Types.h>
+
+///////////////////////////////////////////////////////////
+// Globals
+///////////////////////////////////////////////////////////
+
+extern std::atomic<ark::U64> gAllocationCount;
+
+///////////////////////////////////////////////////////////
+// Definition
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  struct BenchmarkResult
+  {
+    std::string Name;
+    U64 Iterations;
+    R64 NanoSecondsPerOp;
+    R64 BytesPerSecond;
+    R64 AllocationsPerOp;
+  };
+
+  /*
+   * Iteration state handed to every benchmark.
+   *
+   * Benchmarks prepare their inputs and then loop while Next returns true, only the
+   * loop itself is timed. Iterations continue until both the minimum time and the
+   * minimum iteration count are reached.
+   */
+  class BenchmarkState
+  {
+  public:
+
+    BenchmarkState(R64 MinTime, U64 MinIterations);
+
+  public:
+
+    inline auto GetIterations() const { return mIterations; }
+    inline auto GetElapsed() const { return mElapsed; }
+    inline auto GetAllocations() const { return mAllocations; }
+    inline auto GetBytesPerOp() const { return mBytesPerOp; }
+
+  public:
+
+    inline void SetBytesPerOp(U64 Value) { mBytesPerOp = Value; }
+
+  public:
+
+    bool Next();
+
+  private:
+
+    R64 mMinTime;
+    U64 mMinIterations;
+
+    U64 mIterations = 0;
+    U64 mBytesPerOp = 0;
+    U64 mAllocations = 0;
+    R64 mElapsed = 0.0;
+
+    std::chrono::steady_clock::time_point mBegin = {};
+  };
+
+  /*
+   * Self registering benchmark.
+   *
+   * Every instance adds itself to a global list at static initialization time, so
+   * benchmarks are declared as file scope statics next to the code they measure.
+   */
+  class Benchmark
+  {
+  public:
+
+    Benchmark(const char* Name, std::function<void(BenchmarkState&)> Function);
+
+  public:
+
+    static std::vector<Benchmark*>& GetBenchmarks();
+
+  public:
+
+    inline auto GetName() const { return mName; }
+
+  public:
+
+    BenchmarkResult Run(R64 MinTime, U64 MinIterations);
+
+  private:
+
+    const char* mName;
+
+    std::function<void(BenchmarkState&)> mFunction;
+  };
+
+  template<typename T>
+  inline void DoNotOptimize(const T& Value)
+  {
+#if defined(OS_WINDOWS)
+    static const void* volatile sSink = nullptr;
+
+    sSink = &Value;
+#else
+    asm volatile("" : : "r,m"(Value) : "memory");
+#endif
+  }
+}
\ No newline at end of file
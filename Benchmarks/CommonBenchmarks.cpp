@@ -0,0 +1,164 @@
+#include <Common/BinaryReader.h>
+#include <Common/BlowFish.h>
+#include <Common/Crc32.h>
+
+#include <Common/Trees/ArchiveNode.h>
+
+#include <Common/Utils/StringUtils.h>
+
+#include <Benchmarks/Benchmark.h>
+#include <Generator/Dataset.h>
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static constexpr U64 sBufferSize = 4ULL * 1024ULL * 1024ULL;
+  static constexpr const char* sEncryptionKey = "YaKiNiKuM2rrVrPJpGMkfe3EK4RbpbHw";
+}
+
+///////////////////////////////////////////////////////////
+// Benchmarks
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static Benchmark sBlowFishDecrypt = { "BlowFish::Decrypt", [](BenchmarkState& State)
+  {
+    BlowFish cypher = { sEncryptionKey };
+    std::vector<U8> bytes = Dataset::RandomBytes(sBufferSize, 1);
+
+    State.SetBytesPerOp(bytes.size());
+
+    while (State.Next())
+    {
+      cypher.Decrypt(bytes);
+
+      DoNotOptimize(bytes[0]);
+    }
+  } };
+
+  static Benchmark sBlowFishKeySchedule = { "BlowFish::BlowFish", [](BenchmarkState& State)
+  {
+    while (State.Next())
+    {
+      BlowFish cypher = { sEncryptionKey };
+
+      DoNotOptimize(cypher);
+    }
+  } };
+
+  static Benchmark sCrc32FromBytes = { "Crc32::FromBytes", [](BenchmarkState& State)
+  {
+    std::vector<U8> bytes = Dataset::RandomBytes(sBufferSize, 2);
+
+    State.SetBytesPerOp(bytes.size());
+
+    while (State.Next())
+    {
+      DoNotOptimize(Crc32::FromBytes(bytes));
+    }
+  } };
+
+  static Benchmark sArchiveNodeNested = { "ArchiveNode::ArchiveNode/Nested", [](BenchmarkState& State)
+  {
+    std::vector<U8> bytes = Dataset::NestedArchive(32, 32, 4096, 3);
+
+    State.SetBytesPerOp(bytes.size());
+
+    while (State.Next())
+    {
+      ArchiveNode archive = { bytes };
+
+      DoNotOptimize(archive.IsArchive());
+    }
+  } };
+
+  static Benchmark sStringUtilsRemoveNulls = { "StringUtils::RemoveNulls", [](BenchmarkState& State)
+  {
+    std::string string = std::string{ "r100\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0", 20 };
+
+    State.SetBytesPerOp(string.size());
+
+    while (State.Next())
+    {
+      DoNotOptimize(StringUtils::RemoveNulls(string));
+    }
+  } };
+
+  static Benchmark sStringUtilsPosixPath = { "StringUtils::PosixPath", [](BenchmarkState& State)
+  {
+    std::string string = "C:\\Program Files (x86)\\Steam\\steamapps\\common\\Okami\\data_pc\\st1\\r100.dat";
+
+    State.SetBytesPerOp(string.size());
+
+    while (State.Next())
+    {
+      DoNotOptimize(StringUtils::PosixPath(string));
+    }
+  } };
+
+  static Benchmark sStringUtilsSelectExpr = { "StringUtils::SelectExpr", [](BenchmarkState& State)
+  {
+    std::string string = "r100";
+
+    State.SetBytesPerOp(string.size());
+
+    while (State.Next())
+    {
+      DoNotOptimize(StringUtils::SelectExpr(string, "??XX"));
+    }
+  } };
+
+  static Benchmark sStringUtilsCutFront = { "StringUtils::CutFront", [](BenchmarkState& State)
+  {
+    std::string string = "C:/Program Files (x86)/Steam/steamapps/common/Okami/data_pc/st1/r100.dat";
+
+    State.SetBytesPerOp(string.size());
+
+    while (State.Next())
+    {
+      DoNotOptimize(StringUtils::CutFront(string, 59));
+    }
+  } };
+
+  static Benchmark sBinaryReaderRead = { "BinaryReader::Read<U32>", [](BenchmarkState& State)
+  {
+    BinaryReader binaryReader = { Dataset::RandomBytes(sBufferSize, 4) };
+
+    State.SetBytesPerOp(sBufferSize);
+
+    while (State.Next())
+    {
+      U32 sum = 0;
+
+      binaryReader.SeekAbsolute(0);
+
+      for (U64 i = 0; i < (sBufferSize / sizeof(U32)); i++)
+      {
+        sum += binaryReader.Read<U32>();
+      }
+
+      DoNotOptimize(sum);
+    }
+  } };
+
+  static Benchmark sBinaryReaderReadVector = { "BinaryReader::Read<U32>/Vector", [](BenchmarkState& State)
+  {
+    BinaryReader binaryReader = { Dataset::RandomBytes(sBufferSize, 5) };
+
+    State.SetBytesPerOp(sBufferSize);
+
+    while (State.Next())
+    {
+      binaryReader.SeekAbsolute(0);
+
+      for (U64 i = 0; i < (sBufferSize / 4096); i++)
+      {
+        DoNotOptimize(binaryReader.Read<U32>(1024));
+      }
+    }
+  } };
+}
\ No newline at end of file
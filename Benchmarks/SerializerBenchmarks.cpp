@@ -0,0 +1,60 @@
+#include <memory_resource>
+
+#include <Benchmarks/Benchmark.h>
+#include <Generator/Dataset.h>
+
+#include <Editor/Serializer/ModelSerializer.h>
+#include <Editor/Serializer/ObjectSerializer.h>
+
+///////////////////////////////////////////////////////////
+// Benchmarks
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static Benchmark sModelSerializer = { "ModelSerializer::ModelSerializer", [](BenchmarkState& State)
+  {
+    std::vector<U8> bytes = Dataset::Scr(16, 4, 512, 4, 6);
+
+    State.SetBytesPerOp(bytes.size());
+
+    while (State.Next())
+    {
+      std::pmr::monotonic_buffer_resource arena = {};
+
+      ModelSerializer modelSerializer = { &arena, "r100", bytes, 0 };
+
+      DoNotOptimize(modelSerializer.GetModelGroup().GetEntryCount());
+    }
+  } };
+
+  static Benchmark sModelSerializerOptimized = { "ModelSerializer::ModelSerializer/Optimized", [](BenchmarkState& State)
+  {
+    std::vector<U8> bytes = Dataset::Scr(16, 4, 512, 4, 6);
+
+    State.SetBytesPerOp(bytes.size());
+
+    while (State.Next())
+    {
+      std::pmr::monotonic_buffer_resource arena = {};
+
+      ModelSerializer modelSerializer = { &arena, "r100", bytes, 1 };
+
+      DoNotOptimize(modelSerializer.GetModelGroup().GetEntryCount());
+    }
+  } };
+
+  static Benchmark sObjectSerializer = { "ObjectSerializer::ObjectSerializer", [](BenchmarkState& State)
+  {
+    std::vector<U8> bytes = Dataset::Tsc(4096, 7);
+
+    State.SetBytesPerOp(bytes.size());
+
+    while (State.Next())
+    {
+      ObjectSerializer objectSerializer = { bytes };
+
+      DoNotOptimize(objectSerializer.GetObjects().size());
+    }
+  } };
+}
\ No newline at end of file
@@ -49,4 +49,23 @@ namespace ark
 
     return crc;
   }
+
+  U32 Crc32::FromData(const void* Data, U64 Size, U32 Crc, U64 DefaultChunkSize)
+  {
+    U64 bytesProcessed = 0;
+    U64 bytesLeft;
+    U64 chunkSize;
+
+    while (bytesProcessed < Size)
+    {
+      bytesLeft = Size - bytesProcessed;
+      chunkSize = (DefaultChunkSize < bytesLeft) ? DefaultChunkSize : bytesLeft;
+
+      Crc = crc32_fast(&((const U8*)Data)[bytesProcessed], chunkSize, Crc);
+
+      bytesProcessed += chunkSize;
+    }
+
+    return Crc;
+  }
 }
\ No newline at end of file
@@ -17,5 +17,6 @@ namespace ark
 
     static U32 FromString(const std::string& String, U64 DefaultChunkSize = 4ULL * 1024ULL);
     static U32 FromBytes(const std::vector<U8>& Bytes, U64 DefaultChunkSize = 4ULL * 1024ULL);
+    static U32 FromData(const void* Data, U64 Size, U32 Crc = 0, U64 DefaultChunkSize = 4ULL * 1024ULL);
   };
 }
\ No newline at end of file
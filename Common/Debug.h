@@ -1,17 +1,26 @@
 #pragma once
 
-#include <cstdio>
-
 #include <Common/Platform.h>
+#include <Common/Logger.h>
 
 ///////////////////////////////////////////////////////////
 // Definition
 ///////////////////////////////////////////////////////////
 
-#if defined(OS_WINDOWS)
-  #define LOG(FMT, ...) std::printf(FMT, __VA_ARGS__)
-#elif defined(OS_LINUX)
-  #define LOG(FMT, ...) std::printf(FMT __VA_OPT__(,) __VA_ARGS__)
-#else
-  #error "Platform not supported!"
-#endif
\ No newline at end of file
+#if !defined(LOG_LEVEL)
+  #if defined(NDEBUG)
+    #define LOG_LEVEL 2
+  #else
+    #define LOG_LEVEL 0
+  #endif
+#endif
+
+#define LOG_MESSAGE(LEVEL, ...) do { if constexpr ((LEVEL) >= LOG_LEVEL) ::ark::Logger::Write(LEVEL, __VA_ARGS__); } while (0)
+
+#define LOG_TRACE(...) LOG_MESSAGE(::ark::eLogLevelTrace, __VA_ARGS__)
+#define LOG_DEBUG(...) LOG_MESSAGE(::ark::eLogLevelDebug, __VA_ARGS__)
+#define LOG_INFO(...) LOG_MESSAGE(::ark::eLogLevelInfo, __VA_ARGS__)
+#define LOG_WARNING(...) LOG_MESSAGE(::ark::eLogLevelWarning, __VA_ARGS__)
+#define LOG_ERROR(...) LOG_MESSAGE(::ark::eLogLevelError, __VA_ARGS__)
+
+#define LOG(...) LOG_INFO(__VA_ARGS__)
\ No newline at end of file
@@ -0,0 +1,189 @@
+#include <system_error>
+
+#include <Common/Platform.h>
+#include <Common/FileWatcher.h>
+
+#if defined(OS_LINUX)
+  #include <unistd.h>
+  #include <sys/inotify.h>
+#endif
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  FileWatcher::FileWatcher(const fs::path& Dir)
+    : mDir{ Dir }
+  {
+#if defined(OS_LINUX)
+    std::error_code error = {};
+
+    if (fs::is_directory(mDir, error))
+    {
+      mHandle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+      if (mHandle >= 0)
+      {
+        Watch(mDir);
+      }
+    }
+#endif
+  }
+
+  FileWatcher::~FileWatcher()
+  {
+#if defined(OS_LINUX)
+    if (mHandle >= 0)
+    {
+      close(mHandle);
+    }
+#endif
+  }
+
+  U32 FileWatcher::Watch(const fs::path& Dir)
+  {
+#if defined(OS_LINUX)
+    if (mHandle < 0)
+    {
+      return 0;
+    }
+
+    // Watching the same directory again hands back the same descriptor
+
+    I32 watch = inotify_add_watch(mHandle, Dir.string().c_str(), IN_CREATE | IN_DELETE | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO | IN_MOVE_SELF | IN_ONLYDIR);
+
+    if (watch < 0)
+    {
+      return 0;
+    }
+
+    mWatches[watch] = Dir;
+
+    return 1;
+#else
+    return 0;
+#endif
+  }
+
+  void FileWatcher::Unwatch(const fs::path& Dir)
+  {
+#if defined(OS_LINUX)
+    for (auto it = mWatches.begin(); it != mWatches.end(); it++)
+    {
+      if (it->second == Dir)
+      {
+        inotify_rm_watch(mHandle, it->first);
+
+        mWatches.erase(it);
+
+        break;
+      }
+    }
+#endif
+  }
+
+  std::vector<FileEvent> FileWatcher::Poll()
+  {
+    std::vector<FileEvent> events = {};
+
+#if defined(OS_LINUX)
+    if (mHandle < 0)
+    {
+      return events;
+    }
+
+    alignas(inotify_event) char buffer[16384];
+
+    while (true)
+    {
+      ssize_t size = read(mHandle, buffer, sizeof(buffer));
+
+      if (size <= 0)
+      {
+        break;
+      }
+
+      for (char* it = buffer; it < (buffer + size); it += sizeof(inotify_event) + ((inotify_event*)it)->len)
+      {
+        const inotify_event* event = (const inotify_event*)it;
+
+        if (event->mask & IN_Q_OVERFLOW)
+        {
+          events.emplace_back(FileEvent{ eFileEventOverflow, mDir, 1 });
+
+          continue;
+        }
+
+        if (event->mask & IN_IGNORED)
+        {
+          mWatches.erase(event->wd);
+
+          continue;
+        }
+
+        auto watchIt = mWatches.find(event->wd);
+
+        if (watchIt == mWatches.end())
+        {
+          continue;
+        }
+
+        // A moved directory keeps its descriptors, their paths would be stale from now on
+
+        if (event->mask & IN_MOVE_SELF)
+        {
+          UnwatchRecursive(fs::path{ watchIt->second });
+
+          continue;
+        }
+
+        if (event->len == 0)
+        {
+          continue;
+        }
+
+        fs::path file = watchIt->second / event->name;
+        U32 isDirectory = (event->mask & IN_ISDIR) ? 1 : 0;
+
+        if (event->mask & (IN_CREATE | IN_MOVED_TO))
+        {
+          events.emplace_back(FileEvent{ eFileEventCreated, file, isDirectory });
+        }
+        else if (event->mask & (IN_DELETE | IN_MOVED_FROM))
+        {
+          events.emplace_back(FileEvent{ eFileEventDeleted, file, isDirectory });
+        }
+        else if (event->mask & IN_CLOSE_WRITE)
+        {
+          events.emplace_back(FileEvent{ eFileEventModified, file, isDirectory });
+        }
+      }
+    }
+#endif
+
+    return events;
+  }
+
+  void FileWatcher::UnwatchRecursive(const fs::path& Dir)
+  {
+#if defined(OS_LINUX)
+    for (auto it = mWatches.begin(); it != mWatches.end();)
+    {
+      fs::path relative = it->second.lexically_relative(Dir);
+
+      if (!relative.empty() && *relative.begin() != "..")
+      {
+        inotify_rm_watch(mHandle, it->first);
+
+        it = mWatches.erase(it);
+      }
+      else
+      {
+        it++;
+      }
+    }
+#endif
+  }
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <filesystem>
+#include <map>
+#include <vector>
+
+#include <Common/Types.h>
+
+///////////////////////////////////////////////////////////
+// Namespaces
+///////////////////////////////////////////////////////////
+
+namespace fs = std::filesystem;
+
+///////////////////////////////////////////////////////////
+// Definition
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  enum FileEventType
+  {
+    eFileEventCreated = 0,
+    eFileEventDeleted = 1,
+    eFileEventModified = 2,
+    eFileEventOverflow = 3,
+  };
+
+  struct FileEvent
+  {
+    FileEventType Type;
+    fs::path File;
+    U32 IsDirectory;
+  };
+
+  /*
+   * Reports changes within a set of directories, built on inotify.
+   *
+   * Poll never blocks and returns the events queued since the last call. Files count as
+   * modified once they were closed after writing, moves are reported as a delete and a
+   * create. Only the directory given on construction is watched up front, further ones
+   * are added and removed one by one, so nothing ever walks a whole tree. Watches of a
+   * directory moved away are dropped along with those below it. When the kernel queue
+   * overflows a single overflow event for the root directory is reported instead. On
+   * platforms without inotify the watcher never opens and reports nothing.
+   */
+  class FileWatcher
+  {
+  public:
+
+    FileWatcher(const fs::path& Dir);
+    FileWatcher(const FileWatcher& Other) = delete;
+    virtual ~FileWatcher();
+
+  public:
+
+    inline auto IsOpen() const { return mHandle >= 0; }
+    inline const auto& GetDir() const { return mDir; }
+
+  public:
+
+    U32 Watch(const fs::path& Dir);
+    void Unwatch(const fs::path& Dir);
+
+    std::vector<FileEvent> Poll();
+
+  private:
+
+    void UnwatchRecursive(const fs::path& Dir);
+
+  private:
+
+    fs::path mDir;
+
+    I32 mHandle = -1;
+    std::map<I32, fs::path> mWatches = {};
+  };
+}
\ No newline at end of file
@@ -16,5 +16,8 @@ namespace ark
 
   class BinaryReader;
   class BlowFish;
+  class Packer;
   class ExtensionIterator;
+  class JobSystem;
+  class VirtualFileSystem;
 }
\ No newline at end of file
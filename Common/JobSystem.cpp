@@ -0,0 +1,382 @@
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+#include <Common/JobSystem.h>
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  struct JobQueue
+  {
+    std::mutex Mutex = {};
+    std::deque<JobHandle> Jobs = {};
+
+    void Push(const JobHandle& Job)
+    {
+      std::lock_guard<std::mutex> lock{ Mutex };
+
+      Jobs.emplace_back(Job);
+    }
+
+    JobHandle PopBack()
+    {
+      std::lock_guard<std::mutex> lock{ Mutex };
+
+      if (Jobs.empty())
+      {
+        return nullptr;
+      }
+
+      JobHandle job = std::move(Jobs.back());
+
+      Jobs.pop_back();
+
+      return job;
+    }
+
+    JobHandle PopFront()
+    {
+      std::lock_guard<std::mutex> lock{ Mutex };
+
+      if (Jobs.empty())
+      {
+        return nullptr;
+      }
+
+      JobHandle job = std::move(Jobs.front());
+
+      Jobs.pop_front();
+
+      return job;
+    }
+  };
+
+  struct JobWorkers
+  {
+    std::vector<std::unique_ptr<JobQueue>> Queues = {};
+    std::vector<std::thread> Threads = {};
+
+    JobQueue SharedQueue = {};
+    JobQueue MainQueue = {};
+
+    std::thread::id MainThread = {};
+
+    std::mutex SleepMutex = {};
+    std::condition_variable SleepCondition = {};
+    std::atomic<U64> Pending = 0;
+    std::atomic<U32> Running = 0;
+
+    ~JobWorkers()
+    {
+      JobSystem::Shutdown();
+    }
+  };
+
+  static JobWorkers sWorkers = {};
+
+  static std::mutex sInitializeMutex = {};
+  static std::atomic<U32> sInitialized = 0;
+
+  static thread_local I32 sWorkerIndex = -1;
+
+  static void EnsureInitialized()
+  {
+    if (!sInitialized.load(std::memory_order_acquire))
+    {
+      JobSystem::Initialize();
+    }
+  }
+}
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  Job::Job(std::function<void()>&& Function, JobAffinity Affinity, const CancellationToken* Token)
+    : mFunction{ std::move(Function) }
+    , mAffinity{ Affinity }
+  {
+    if (Token)
+    {
+      mToken = *Token;
+      mCancellable = 1;
+    }
+  }
+
+  void JobSystem::Initialize(U32 WorkerCount)
+  {
+    std::lock_guard<std::mutex> lock{ sInitializeMutex };
+
+    // After a shutdown jobs keep working, they are run by the waiting threads instead
+
+    if (sInitialized)
+    {
+      return;
+    }
+
+    if (WorkerCount == 0)
+    {
+      WorkerCount = std::max(1U, std::thread::hardware_concurrency() - 1);
+    }
+
+    sWorkers.MainThread = std::this_thread::get_id();
+    sWorkers.Running = 1;
+
+    for (U32 i = 0; i < WorkerCount; i++)
+    {
+      sWorkers.Queues.emplace_back(std::make_unique<JobQueue>());
+    }
+
+    for (U32 i = 0; i < WorkerCount; i++)
+    {
+      sWorkers.Threads.emplace_back([i]()
+      {
+        sWorkerIndex = (I32)i;
+
+        while (sWorkers.Running)
+        {
+          if (!TryRunOne())
+          {
+            // Jobs are counted under the sleep mutex when queued, so no wakeup gets lost
+
+            std::unique_lock<std::mutex> lock{ sWorkers.SleepMutex };
+
+            sWorkers.SleepCondition.wait(lock, []() { return !sWorkers.Running || sWorkers.Pending > 0; });
+          }
+        }
+      });
+    }
+
+    sInitialized.store(1, std::memory_order_release);
+  }
+
+  void JobSystem::Shutdown()
+  {
+    if (!sWorkers.Running)
+    {
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock{ sWorkers.SleepMutex };
+
+      sWorkers.Running = 0;
+      sWorkers.SleepCondition.notify_all();
+    }
+
+    for (auto& thread : sWorkers.Threads)
+    {
+      thread.join();
+    }
+
+    // Jobs left behind by the workers move to the shared queue where waiting threads still find them
+
+    for (auto& queue : sWorkers.Queues)
+    {
+      while (JobHandle job = queue->PopFront())
+      {
+        sWorkers.SharedQueue.Push(job);
+      }
+    }
+
+    sWorkers.Threads.clear();
+    sWorkers.Queues.clear();
+  }
+
+  U32 JobSystem::GetWorkerCount()
+  {
+    EnsureInitialized();
+
+    return (U32)sWorkers.Threads.size();
+  }
+
+  JobHandle JobSystem::Schedule(std::function<void()> Function, const std::vector<JobHandle>& Dependencies, JobAffinity Affinity, const CancellationToken* Token)
+  {
+    EnsureInitialized();
+
+    JobHandle job = std::make_shared<Job>(std::move(Function), Affinity, Token);
+
+    // The initial count of one keeps the job from starting while dependencies are added
+
+    for (const auto& dependency : Dependencies)
+    {
+      std::lock_guard<std::mutex> lock{ dependency->mMutex };
+
+      if (!dependency->IsFinished())
+      {
+        job->mDependencies.fetch_add(1, std::memory_order_relaxed);
+
+        dependency->mContinuations.emplace_back(job);
+      }
+    }
+
+    if (job->mDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+      Enqueue(job);
+    }
+
+    return job;
+  }
+
+  JobHandle JobSystem::Then(const JobHandle& Job, std::function<void()> Function, JobAffinity Affinity)
+  {
+    return Schedule(std::move(Function), { Job }, Affinity);
+  }
+
+  void JobSystem::Wait(const JobHandle& Job)
+  {
+    while (!Job->IsFinished())
+    {
+      if (!TryRunOne())
+      {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  void JobSystem::WaitAll(const std::vector<JobHandle>& Jobs)
+  {
+    for (const auto& job : Jobs)
+    {
+      Wait(job);
+    }
+  }
+
+  U32 JobSystem::RunMainThreadJobs(U32 MaxCount)
+  {
+    U32 count = 0;
+
+    while (count < MaxCount)
+    {
+      JobHandle job = sWorkers.MainQueue.PopFront();
+
+      if (!job)
+      {
+        break;
+      }
+
+      Execute(job);
+
+      count++;
+    }
+
+    return count;
+  }
+
+  void JobSystem::Enqueue(const JobHandle& Job)
+  {
+    if (Job->mAffinity == eJobAffinityMain)
+    {
+      sWorkers.MainQueue.Push(Job);
+
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock{ sWorkers.SleepMutex };
+
+    sWorkers.Pending.fetch_add(1, std::memory_order_relaxed);
+
+    if (sWorkerIndex >= 0 && sWorkers.Running)
+    {
+      sWorkers.Queues[sWorkerIndex]->Push(Job);
+    }
+    else
+    {
+      sWorkers.SharedQueue.Push(Job);
+    }
+
+    sWorkers.SleepCondition.notify_one();
+  }
+
+  void JobSystem::Execute(const JobHandle& Job)
+  {
+    if (!Job->mCancellable || !Job->mToken.IsCancelled())
+    {
+      Job->mFunction();
+    }
+
+    Job->mFunction = nullptr;
+
+    std::vector<JobHandle> continuations = {};
+
+    {
+      std::lock_guard<std::mutex> lock{ Job->mMutex };
+
+      Job->mFinished.store(1, std::memory_order_release);
+
+      continuations.swap(Job->mContinuations);
+    }
+
+    for (const auto& continuation : continuations)
+    {
+      if (continuation->mDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      {
+        Enqueue(continuation);
+      }
+    }
+  }
+
+  U32 JobSystem::TryRunOne()
+  {
+    JobHandle job = nullptr;
+
+    if (sWorkerIndex >= 0)
+    {
+      job = sWorkers.Queues[sWorkerIndex]->PopBack();
+    }
+    else if (std::this_thread::get_id() == sWorkers.MainThread)
+    {
+      job = sWorkers.MainQueue.PopFront();
+
+      if (job)
+      {
+        Execute(job);
+
+        return 1;
+      }
+    }
+
+    if (!job)
+    {
+      job = sWorkers.SharedQueue.PopFront();
+    }
+
+    if (!job)
+    {
+      // Steal the oldest job of another worker, starting after the own index
+
+      U32 count = (U32)sWorkers.Queues.size();
+      U32 start = (sWorkerIndex >= 0) ? (U32)sWorkerIndex + 1 : 0;
+
+      for (U32 i = 0; i < count && !job; i++)
+      {
+        U32 index = (start + i) % count;
+
+        if ((I32)index != sWorkerIndex)
+        {
+          job = sWorkers.Queues[index]->PopFront();
+        }
+      }
+    }
+
+    if (!job)
+    {
+      return 0;
+    }
+
+    // Only jobs of the worker and shared queues are counted as pending
+
+    sWorkers.Pending.fetch_sub(1, std::memory_order_relaxed);
+
+    Execute(job);
+
+    return 1;
+  }
+}
\ No newline at end of file
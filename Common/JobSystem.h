@@ -0,0 +1,204 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <Common/Types.h>
+
+///////////////////////////////////////////////////////////
+// Definition
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  enum JobAffinity
+  {
+    eJobAffinityAny = 0,
+    eJobAffinityMain = 1,
+  };
+
+  class CancellationToken
+  {
+  public:
+
+    inline auto IsCancelled() const { return mCancelled->load(std::memory_order_relaxed) != 0; }
+
+  public:
+
+    inline void Cancel() { mCancelled->store(1, std::memory_order_relaxed); }
+
+  private:
+
+    std::shared_ptr<std::atomic<U32>> mCancelled = std::make_shared<std::atomic<U32>>(0);
+  };
+
+  class JobCounter
+  {
+  public:
+
+    inline auto GetTotal() const { return mTotal.load(std::memory_order_relaxed); }
+    inline auto GetCompleted() const { return mCompleted.load(std::memory_order_relaxed); }
+    inline auto IsDone() const { return GetCompleted() >= GetTotal(); }
+
+  public:
+
+    inline void Add(U32 Count) { mTotal.fetch_add(Count, std::memory_order_relaxed); }
+    inline void Complete(U32 Count = 1) { mCompleted.fetch_add(Count, std::memory_order_relaxed); }
+
+  private:
+
+    std::atomic<U32> mTotal = 0;
+    std::atomic<U32> mCompleted = 0;
+  };
+
+  class Job
+  {
+  public:
+
+    Job(std::function<void()>&& Function, JobAffinity Affinity, const CancellationToken* Token);
+
+  public:
+
+    inline auto IsFinished() const { return mFinished.load(std::memory_order_acquire) != 0; }
+    inline auto GetAffinity() const { return mAffinity; }
+
+  private:
+
+    friend class JobSystem;
+
+    std::function<void()> mFunction;
+    JobAffinity mAffinity;
+    CancellationToken mToken = {};
+    U32 mCancellable = 0;
+
+    std::atomic<U32> mDependencies = 1;
+    std::atomic<U32> mFinished = 0;
+
+    std::mutex mMutex = {};
+    std::vector<std::shared_ptr<Job>> mContinuations = {};
+  };
+
+  using JobHandle = std::shared_ptr<Job>;
+
+  struct ParallelForOptions
+  {
+    U32 Grain = 1;
+    U32 MaxJobs = 0;
+    const CancellationToken* Token = nullptr;
+    JobCounter* Counter = nullptr;
+  };
+
+  /*
+   * Work stealing job system shared by the tools and the editor.
+   *
+   * Every worker owns a deque, it pushes and pops its own jobs at the back while idle
+   * workers steal from the front of the others. Jobs scheduled from other threads go
+   * through a shared queue, jobs with main affinity are only run by the thread which
+   * initialized the system, from RunMainThreadJobs or while it waits. A job starts once
+   * all of its dependencies finished, continuations are jobs depending on one other.
+   * Waiting threads run pending jobs instead of blocking, so waits may nest.
+   */
+  class JobSystem
+  {
+  public:
+
+    static void Initialize(U32 WorkerCount = 0);
+    static void Shutdown();
+
+  public:
+
+    static U32 GetWorkerCount();
+
+  public:
+
+    static JobHandle Schedule(std::function<void()> Function, const std::vector<JobHandle>& Dependencies = {}, JobAffinity Affinity = eJobAffinityAny, const CancellationToken* Token = nullptr);
+    static JobHandle Then(const JobHandle& Job, std::function<void()> Function, JobAffinity Affinity = eJobAffinityAny);
+
+    static void Wait(const JobHandle& Job);
+    static void WaitAll(const std::vector<JobHandle>& Jobs);
+
+  public:
+
+    template<typename F>
+    static U32 ParallelFor(U32 Count, F&& Function, const ParallelForOptions& Options = {});
+
+  public:
+
+    static U32 RunMainThreadJobs(U32 MaxCount = 0xFFFFFFFF);
+
+  private:
+
+    static void Enqueue(const JobHandle& Job);
+    static void Execute(const JobHandle& Job);
+    static U32 TryRunOne();
+  };
+}
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  template<typename F>
+  U32 JobSystem::ParallelFor(U32 Count, F&& Function, const ParallelForOptions& Options)
+  {
+    // Jobs pull chunks of the range from a shared index until it runs out, so uneven
+    // items balance themselves and the calling thread takes part as well
+
+    std::atomic<U32> next = 0;
+    std::atomic<U32> cancelled = 0;
+
+    U32 grain = std::max(Options.Grain, 1U);
+    U32 chunkCount = (Count + grain - 1) / grain;
+    U32 maxJobs = Options.MaxJobs ? Options.MaxJobs : (GetWorkerCount() + 1);
+    U32 jobCount = std::min(maxJobs, chunkCount);
+
+    if (Options.Counter)
+    {
+      Options.Counter->Add(Count);
+    }
+
+    auto work = [&]()
+    {
+      for (U32 begin = next.fetch_add(grain); begin < Count; begin = next.fetch_add(grain))
+      {
+        U32 end = std::min(begin + grain, Count);
+
+        for (U32 i = begin; i < end; i++)
+        {
+          if (Options.Token && Options.Token->IsCancelled())
+          {
+            cancelled = 1;
+
+            return;
+          }
+
+          Function(i);
+        }
+
+        if (Options.Counter)
+        {
+          Options.Counter->Complete(end - begin);
+        }
+      }
+    };
+
+    std::vector<JobHandle> jobs = {};
+
+    for (U32 i = 1; i < jobCount; i++)
+    {
+      jobs.emplace_back(Schedule(work));
+    }
+
+    work();
+
+    WaitAll(jobs);
+
+    return !cancelled;
+  }
+}
\ No newline at end of file
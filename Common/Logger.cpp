@@ -0,0 +1,337 @@
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <Common/Logger.h>
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  struct LogEntry
+  {
+    U64 Time;
+    U32 Level;
+    std::string Text;
+  };
+
+  class LogSink
+  {
+  public:
+
+    LogSink()
+      : mThread{ &LogSink::Work, this }
+    {
+
+    }
+
+    ~LogSink()
+    {
+      mRunning = 0;
+      mThread.join();
+
+      Drain();
+    }
+
+  public:
+
+    void Register(const std::shared_ptr<LogRing>& Ring)
+    {
+      std::lock_guard<std::mutex> lock{ mRingMutex };
+
+      mRings.emplace_back(Ring);
+    }
+
+    void Flush()
+    {
+      std::lock_guard<std::mutex> lock{ mDrainMutex };
+
+      DrainLocked();
+    }
+
+  public:
+
+    U64 GetDropped()
+    {
+      std::lock_guard<std::mutex> lock{ mRingMutex };
+
+      U64 dropped = mDropped;
+
+      for (const auto& ring : mRings)
+      {
+        dropped += ring->GetDropped();
+      }
+
+      return dropped;
+    }
+
+  public:
+
+    std::mutex mConfigMutex = {};
+    U32 mConsole = 1;
+    std::ofstream mFile = {};
+
+    std::mutex mHistoryMutex = {};
+    std::deque<std::pair<U32, std::string>> mHistory = {};
+    U32 mHistorySize = 0;
+
+  private:
+
+    void Work()
+    {
+      while (mRunning)
+      {
+        if (!Drain())
+        {
+          std::this_thread::sleep_for(std::chrono::milliseconds{ 2 });
+        }
+      }
+    }
+
+    U32 Drain()
+    {
+      std::lock_guard<std::mutex> lock{ mDrainMutex };
+
+      return DrainLocked();
+    }
+
+    U32 DrainLocked()
+    {
+      {
+        std::lock_guard<std::mutex> lock{ mRingMutex };
+
+        // Rings whose thread has exited are dropped once they ran empty
+
+        std::erase_if(mRings, [this](const std::shared_ptr<LogRing>& Ring)
+        {
+          if (Ring.use_count() == 1 && Ring->IsEmpty())
+          {
+            mDropped += Ring->GetDropped();
+
+            return true;
+          }
+
+          return false;
+        });
+
+        mDrainRings = mRings;
+      }
+
+      mEntries.clear();
+
+      for (const auto& ring : mDrainRings)
+      {
+        ring->Drain([this](const LogRecord& Record)
+        {
+          LogEntry& entry = mEntries.emplace_back(LogEntry{ Record.Time, Record.Level, {} });
+
+          Record.Formatter(Record, entry.Text);
+        });
+      }
+
+      // Threads are drained one after another, the entries are put back into time order
+
+      std::stable_sort(mEntries.begin(), mEntries.end(), [](const LogEntry& A, const LogEntry& B) { return A.Time < B.Time; });
+
+      if (mEntries.empty())
+      {
+        return 0;
+      }
+
+      {
+        std::lock_guard<std::mutex> lock{ mConfigMutex };
+
+        for (const auto& entry : mEntries)
+        {
+          if (mConsole)
+          {
+            std::fwrite(entry.Text.data(), 1, entry.Text.size(), (entry.Level >= eLogLevelWarning) ? stderr : stdout);
+          }
+
+          if (mFile.is_open())
+          {
+            mFile.write(entry.Text.data(), (std::streamsize)entry.Text.size());
+          }
+        }
+
+        std::fflush(stdout);
+
+        if (mFile.is_open())
+        {
+          mFile.flush();
+        }
+      }
+
+      {
+        std::lock_guard<std::mutex> lock{ mHistoryMutex };
+
+        if (mHistorySize)
+        {
+          for (auto& entry : mEntries)
+          {
+            while (!entry.Text.empty() && entry.Text.back() == '\n')
+            {
+              entry.Text.pop_back();
+            }
+
+            mHistory.emplace_back(entry.Level, std::move(entry.Text));
+          }
+
+          while (mHistory.size() > mHistorySize)
+          {
+            mHistory.pop_front();
+          }
+        }
+      }
+
+      return (U32)mEntries.size();
+    }
+
+  private:
+
+    std::mutex mRingMutex = {};
+    std::vector<std::shared_ptr<LogRing>> mRings = {};
+    U64 mDropped = 0;
+
+    std::mutex mDrainMutex = {};
+    std::vector<std::shared_ptr<LogRing>> mDrainRings = {};
+    std::vector<LogEntry> mEntries = {};
+
+    std::atomic<U32> mRunning = 1;
+    std::thread mThread;
+  };
+
+  static LogSink& GetSink()
+  {
+    static LogSink sink = {};
+
+    return sink;
+  }
+}
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  LogRecord* LogRing::Acquire()
+  {
+    U32 head = mHead.load(std::memory_order_relaxed);
+
+    if ((head - mTail.load(std::memory_order_acquire)) >= sCapacity)
+    {
+      mDropped.fetch_add(1, std::memory_order_relaxed);
+
+      return nullptr;
+    }
+
+    return &mRecords[head % sCapacity];
+  }
+
+  void LogRing::Commit()
+  {
+    mHead.store(mHead.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  void Logger::SetConsole(U32 Enabled)
+  {
+    LogSink& sink = GetSink();
+
+    std::lock_guard<std::mutex> lock{ sink.mConfigMutex };
+
+    sink.mConsole = Enabled;
+  }
+
+  void Logger::SetFile(const std::string& File)
+  {
+    LogSink& sink = GetSink();
+
+    std::lock_guard<std::mutex> lock{ sink.mConfigMutex };
+
+    sink.mFile.close();
+
+    if (!File.empty())
+    {
+      sink.mFile.open(File, std::ios::binary | std::ios::trunc);
+    }
+  }
+
+  void Logger::SetHistorySize(U32 Size)
+  {
+    LogSink& sink = GetSink();
+
+    std::lock_guard<std::mutex> lock{ sink.mHistoryMutex };
+
+    sink.mHistorySize = Size;
+
+    while (sink.mHistory.size() > Size)
+    {
+      sink.mHistory.pop_front();
+    }
+  }
+
+  U64 Logger::GetDropped()
+  {
+    return GetSink().GetDropped();
+  }
+
+  void Logger::Flush()
+  {
+    GetSink().Flush();
+  }
+
+  LogRing* Logger::GetRing()
+  {
+    // The sink keeps a reference as well, so records of exited threads still get written
+
+    thread_local std::shared_ptr<LogRing> ring = nullptr;
+
+    if (!ring)
+    {
+      ring = std::make_shared<LogRing>();
+
+      GetSink().Register(ring);
+    }
+
+    return ring.get();
+  }
+
+  void Logger::LockHistory()
+  {
+    GetSink().mHistoryMutex.lock();
+  }
+
+  void Logger::UnlockHistory()
+  {
+    GetSink().mHistoryMutex.unlock();
+  }
+
+  U32 Logger::GetHistoryCount()
+  {
+    return (U32)GetSink().mHistory.size();
+  }
+
+  const std::pair<U32, std::string>& Logger::GetHistory(U32 Index)
+  {
+    return GetSink().mHistory[Index];
+  }
+
+  void Logger::FormatLiteral(const LogRecord& Record, std::string& Text)
+  {
+    for (const char* c = Record.Format; *c; c++)
+    {
+      if (c[0] == '%' && c[1] == '%')
+      {
+        c++;
+      }
+
+      Text.push_back(*c);
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,294 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+#include <Common/Types.h>
+
+///////////////////////////////////////////////////////////
+// Definition
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  enum LogLevel
+  {
+    eLogLevelTrace = 0,
+    eLogLevelDebug = 1,
+    eLogLevelInfo = 2,
+    eLogLevelWarning = 3,
+    eLogLevelError = 4,
+  };
+
+  struct LogRecord;
+
+  using LogFormatter = void(*)(const LogRecord& Record, std::string& Text);
+
+  struct LogRecord
+  {
+    static constexpr U32 sArgumentSize = 224;
+
+    U64 Time;
+    const char* Format;
+    LogFormatter Formatter;
+    U32 Level;
+    U32 Reserved;
+    U8 Arguments[sArgumentSize];
+  };
+
+  /*
+   * Single producer, single consumer queue of log records.
+   *
+   * Every logging thread owns one, only the sink thread reads from it. Records are
+   * dropped instead of waiting when the sink falls behind.
+   */
+  class LogRing
+  {
+  public:
+
+    static constexpr U32 sCapacity = 1024;
+
+  public:
+
+    inline auto GetDropped() const { return mDropped.load(std::memory_order_relaxed); }
+    inline auto IsEmpty() const { return mHead.load(std::memory_order_acquire) == mTail.load(std::memory_order_relaxed); }
+
+  public:
+
+    LogRecord* Acquire();
+    void Commit();
+
+  public:
+
+    template<typename F>
+    U32 Drain(F&& Function);
+
+  private:
+
+    LogRecord mRecords[sCapacity] = {};
+
+    alignas(64) std::atomic<U32> mHead = 0;
+    alignas(64) std::atomic<U32> mTail = 0;
+    alignas(64) std::atomic<U64> mDropped = 0;
+  };
+
+  /*
+   * Asynchronous log backend behind the LOG macros.
+   *
+   * A call only copies the format string pointer and its arguments into the ring of
+   * the calling thread, strings are copied by value. A background thread formats the
+   * records in time order and writes them to the console, an optional file and an
+   * optional in memory history which the editor shows. Format strings must be literals.
+   */
+  class Logger
+  {
+  public:
+
+    template<typename ... Args>
+    static void Write(LogLevel Level, const char* Format, Args&& ... Arguments);
+
+  public:
+
+    static void SetConsole(U32 Enabled);
+    static void SetFile(const std::string& File);
+    static void SetHistorySize(U32 Size);
+
+  public:
+
+    static U64 GetDropped();
+
+    template<typename F>
+    static void ForEachHistory(F&& Function);
+
+  public:
+
+    static void Flush();
+
+  private:
+
+    static LogRing* GetRing();
+
+    static void LockHistory();
+    static void UnlockHistory();
+    static U32 GetHistoryCount();
+    static const std::pair<U32, std::string>& GetHistory(U32 Index);
+
+  private:
+
+    template<typename T>
+    using Argument = std::conditional_t<std::is_same_v<std::decay_t<T>, char*> || std::is_same_v<std::decay_t<T>, const char*>, const char*, std::decay_t<T>>;
+
+    template<typename T>
+    static constexpr U64 sArgumentSize = std::is_same_v<T, const char*> ? sizeof(U16) : sizeof(T);
+
+    template<typename T>
+    static void Store(U8* Bytes, U64& Fixed, U64& Strings, T Value);
+
+    template<typename T>
+    static T Load(const U8* Bytes, U64& Fixed);
+
+    template<typename ... Args>
+    static void Format(const LogRecord& Record, std::string& Text);
+
+    static void FormatLiteral(const LogRecord& Record, std::string& Text);
+  };
+}
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  template<typename F>
+  U32 LogRing::Drain(F&& Function)
+  {
+    U32 tail = mTail.load(std::memory_order_relaxed);
+    U32 head = mHead.load(std::memory_order_acquire);
+
+    for (U32 i = tail; i != head; i++)
+    {
+      Function(mRecords[i % sCapacity]);
+    }
+
+    mTail.store(head, std::memory_order_release);
+
+    return head - tail;
+  }
+
+  template<typename ... Args>
+  void Logger::Write(LogLevel Level, const char* Format, Args&& ... Arguments)
+  {
+    static_assert(((std::is_trivially_copyable_v<Argument<Args>>) && ...), "Log arguments must be trivially copyable");
+
+    // Strings need at least the byte of their terminator behind the fixed size arguments
+
+    static_assert((0 + ... + sArgumentSize<Argument<Args>>) + (false || ... || std::is_same_v<Argument<Args>, const char*>) <= LogRecord::sArgumentSize, "Too many log arguments");
+
+    LogRing* ring = GetRing();
+    LogRecord* record = ring->Acquire();
+
+    if (!record)
+    {
+      return;
+    }
+
+    record->Time = (U64)std::chrono::steady_clock::now().time_since_epoch().count();
+    record->Format = Format;
+    record->Level = Level;
+
+    if constexpr (sizeof...(Args) == 0)
+    {
+      record->Formatter = &Logger::FormatLiteral;
+    }
+    else
+    {
+      U64 fixed = 0;
+      U64 strings = (0 + ... + sArgumentSize<Argument<Args>>);
+
+      (Store<Argument<Args>>(record->Arguments, fixed, strings, (Argument<Args>)Arguments), ...);
+
+      record->Formatter = &Logger::Format<Argument<Args> ...>;
+    }
+
+    ring->Commit();
+  }
+
+  template<typename F>
+  void Logger::ForEachHistory(F&& Function)
+  {
+    LockHistory();
+
+    for (U32 i = 0; i < GetHistoryCount(); i++)
+    {
+      const auto& [level, text] = GetHistory(i);
+
+      Function(level, text);
+    }
+
+    UnlockHistory();
+  }
+
+  template<typename T>
+  void Logger::Store(U8* Bytes, U64& Fixed, U64& Strings, T Value)
+  {
+    if constexpr (std::is_same_v<T, const char*>)
+    {
+      // Strings are appended behind the fixed size arguments and cut to the space left
+
+      U16 offset = (U16)Strings;
+      U64 size = std::min<U64>(Value ? std::strlen(Value) : 0, LogRecord::sArgumentSize - Strings - 1);
+
+      std::memcpy(Bytes + Fixed, &offset, sizeof(U16));
+
+      if (size)
+      {
+        std::memcpy(Bytes + Strings, Value, size);
+      }
+
+      Bytes[Strings + size] = 0;
+
+      Fixed += sizeof(U16);
+      Strings = std::min<U64>(Strings + size + 1, LogRecord::sArgumentSize - 1);
+    }
+    else
+    {
+      std::memcpy(Bytes + Fixed, &Value, sizeof(T));
+
+      Fixed += sizeof(T);
+    }
+  }
+
+  template<typename T>
+  T Logger::Load(const U8* Bytes, U64& Fixed)
+  {
+    if constexpr (std::is_same_v<T, const char*>)
+    {
+      U16 offset = 0;
+
+      std::memcpy(&offset, Bytes + Fixed, sizeof(U16));
+
+      Fixed += sizeof(U16);
+
+      return (const char*)(Bytes + offset);
+    }
+    else
+    {
+      T value = {};
+
+      std::memcpy(&value, Bytes + Fixed, sizeof(T));
+
+      Fixed += sizeof(T);
+
+      return value;
+    }
+  }
+
+  template<typename ... Args>
+  void Logger::Format(const LogRecord& Record, std::string& Text)
+  {
+    U64 fixed = 0;
+
+    // Braced initialization loads the arguments in order
+
+    std::tuple<Args ...> arguments = { Load<Args>(Record.Arguments, fixed) ... };
+
+    std::apply([&](auto ... Values)
+    {
+      I32 size = std::snprintf(nullptr, 0, Record.Format, Values ...);
+
+      if (size > 0)
+      {
+        Text.resize((U64)size);
+
+        std::snprintf(Text.data(), (U64)size + 1, Record.Format, Values ...);
+      }
+    }, arguments);
+  }
+}
\ No newline at end of file
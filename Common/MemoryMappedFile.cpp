@@ -0,0 +1,90 @@
+#include <Common/Platform.h>
+#include <Common/MemoryMappedFile.h>
+
+#if defined(OS_WINDOWS)
+  #include <windows.h>
+#elif defined(OS_LINUX)
+  #include <fcntl.h>
+  #include <unistd.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+#endif
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  MemoryMappedFile::MemoryMappedFile(const std::string& File)
+  {
+#if defined(OS_WINDOWS)
+    HANDLE file = CreateFileA(File.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (file != INVALID_HANDLE_VALUE)
+    {
+      LARGE_INTEGER size = {};
+
+      if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+      {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if (mapping)
+        {
+          mData = (const U8*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+          mSize = mData ? (U64)size.QuadPart : 0;
+
+          mMappingHandle = mapping;
+        }
+      }
+
+      mFileHandle = file;
+    }
+#elif defined(OS_LINUX)
+    I32 file = open(File.c_str(), O_RDONLY);
+
+    if (file >= 0)
+    {
+      struct stat status = {};
+
+      if (fstat(file, &status) == 0 && status.st_size > 0)
+      {
+        void* data = mmap(nullptr, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+        if (data != MAP_FAILED)
+        {
+          mData = (const U8*)data;
+          mSize = (U64)status.st_size;
+        }
+      }
+
+      close(file);
+    }
+#endif
+  }
+
+  MemoryMappedFile::~MemoryMappedFile()
+  {
+#if defined(OS_WINDOWS)
+    if (mData)
+    {
+      UnmapViewOfFile(mData);
+    }
+
+    if (mMappingHandle)
+    {
+      CloseHandle(mMappingHandle);
+    }
+
+    if (mFileHandle)
+    {
+      CloseHandle(mFileHandle);
+    }
+#elif defined(OS_LINUX)
+    if (mData)
+    {
+      munmap((void*)mData, mSize);
+    }
+#endif
+  }
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <string>
+
+#include <Common/Types.h>
+
+///////////////////////////////////////////////////////////
+// Definition
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  class MemoryMappedFile
+  {
+  public:
+
+    MemoryMappedFile(const std::string& File);
+    MemoryMappedFile(const MemoryMappedFile& Other) = delete;
+    virtual ~MemoryMappedFile();
+
+  public:
+
+    inline auto IsOpen() const { return mData != nullptr; }
+
+    inline auto GetData() const { return mData; }
+    inline auto GetSize() const { return mSize; }
+
+  private:
+
+    const U8* mData = nullptr;
+    U64 mSize = 0;
+
+    void* mFileHandle = nullptr;
+    void* mMappingHandle = nullptr;
+  };
+}
\ No newline at end of file
@@ -0,0 +1,395 @@
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include <Common/Debug.h>
+#include <Common/BlowFish.h>
+#include <Common/Crc32.h>
+#include <Common/JobSystem.h>
+#include <Common/Packer.h>
+
+#include <Common/Trees/ArchiveNode.h>
+
+#include <Common/Utils/DirUtils.h>
+#include <Common/Utils/FileUtils.h>
+#include <Common/Utils/JsonUtils.h>
+#include <Common/Utils/StringUtils.h>
+
+#include <Vendor/rapidjson/prettywriter.h>
+#include <Vendor/rapidjson/stringbuffer.h>
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  struct UnpackTask
+  {
+    fs::path File;
+    std::string Key;
+  };
+
+  class ProgressReporter
+  {
+  public:
+
+    ProgressReporter(const PackerOptions& Options, const char* Operation, U32 Count)
+      : mOptions{ Options }
+      , mOperation{ Operation }
+      , mCount{ Count }
+    {
+
+    }
+
+  public:
+
+    void Log(const char* Message)
+    {
+      if (!mOptions.Progress)
+      {
+        LOG("%s\n", Message);
+      }
+    }
+
+    void Report(const char* Status, const std::string& File, U32 Crc32 = 0)
+    {
+      std::lock_guard<std::mutex> lock{ mMutex };
+
+      PackerProgress progress = { mOperation, Status, File, ++mIndex, mCount, Crc32 };
+
+      if (mOptions.Progress)
+      {
+        mOptions.Progress(progress);
+      }
+      else
+      {
+        LOG("  [%s] %s\n", progress.Status, progress.File.c_str());
+      }
+    }
+
+  private:
+
+    const PackerOptions& mOptions;
+    const char* mOperation;
+    U32 mCount;
+    U32 mIndex = 0;
+
+    std::mutex mMutex = {};
+  };
+
+  static std::string RelativeKey(const fs::path& File, const fs::path& Dir)
+  {
+    std::string posixFile = StringUtils::PosixPath(File.string());
+    std::string posixDir = StringUtils::PosixPath(Dir.string());
+
+    return StringUtils::CutFront(posixFile, posixDir.size());
+  }
+
+  static U32 CollectDataFiles(const PackerOptions& Options, std::vector<fs::path>& Files)
+  {
+    std::error_code error = {};
+
+    if (!fs::is_directory(Options.DataDir, error))
+    {
+      return 0;
+    }
+
+    for (auto it = fs::recursive_directory_iterator{ Options.DataDir, fs::directory_options::skip_permission_denied, error }; !error && it != fs::recursive_directory_iterator{}; it.increment(error))
+    {
+      std::error_code statusError = {};
+
+      if (it->is_regular_file(statusError) && RelativeKey(it->path(), Options.DataDir).find(Options.Filter) != std::string::npos)
+      {
+        Files.emplace_back(it->path());
+      }
+    }
+
+    std::sort(Files.begin(), Files.end());
+
+    return !error;
+  }
+}
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  PackerOptions Packer::FromConfig(const rj::Value& Config, const rj::Value& Packer)
+  {
+    PackerOptions options = {};
+
+    options.DataDir = fs::path{ Config["gameDir"].GetString() } / "data_pc";
+    options.UnpackDir = Config["unpackDir"].GetString();
+    options.EncryptionKey = Packer["encryptionKey"].GetString();
+    options.Sources = &Packer["sources"];
+    options.ThreadCount = std::max(1U, std::thread::hardware_concurrency());
+
+    return options;
+  }
+
+  U32 Packer::Unpack(const PackerOptions& Options)
+  {
+    // Archives of one level extract into the same directory and may carry the same files,
+    // so every level is handled by a single thread
+
+    std::map<fs::path, std::vector<UnpackTask>> levels = {};
+
+    U32 taskCount = 0;
+
+    DirUtils::CreateIfNotExists(Options.UnpackDir);
+
+    for (auto it = Options.Sources->MemberBegin(); it != Options.Sources->MemberEnd(); it++)
+    {
+      std::string unpackEntryName = it->name.GetString();
+
+      DirUtils::CreateIfNotExists(Options.UnpackDir / unpackEntryName);
+
+      for (const auto& unpackEntry : it->value.GetArray())
+      {
+        std::set<std::string> extensions = JsonUtils::ToStringSet(unpackEntry["extensions"].GetArray());
+
+        DirUtils::CreateIfNotExists(Options.UnpackDir / unpackEntryName / unpackEntry["unpackDir"].GetString());
+
+        if (!fs::exists(Options.DataDir / unpackEntry["sourceDir"].GetString()))
+        {
+          continue;
+        }
+
+        for (const auto& file : fs::directory_iterator{ Options.DataDir / unpackEntry["sourceDir"].GetString() })
+        {
+          std::string key = RelativeKey(file.path(), Options.DataDir);
+
+          if (extensions.contains(file.path().extension().string()) && key.find(Options.Filter) != std::string::npos)
+          {
+            std::string fileName = file.path().stem().string();
+            std::string levelName = StringUtils::SelectExpr(fileName, unpackEntry["selectExpr"].GetString());
+
+            fs::path levelDir = Options.UnpackDir / unpackEntryName / unpackEntry["unpackDir"].GetString() / levelName;
+
+            DirUtils::CreateIfNotExists(levelDir);
+
+            levels[levelDir].emplace_back(UnpackTask{ file.path(), key });
+
+            taskCount++;
+          }
+        }
+      }
+    }
+
+    std::vector<std::pair<fs::path, std::vector<UnpackTask>>> groups = { levels.begin(), levels.end() };
+
+    ProgressReporter reporter = { Options, "unpack", taskCount };
+
+    reporter.Log("Unpacking, please wait...");
+
+    BlowFish cypher = { Options.EncryptionKey };
+
+    JobSystem::ParallelFor((U32)groups.size(), [&](U32 Index)
+    {
+      const auto& [levelDir, tasks] = groups[Index];
+
+      for (const auto& task : tasks)
+      {
+        std::vector<U8> bytes = FileUtils::ReadBinary(task.File.string());
+
+        cypher.Decrypt(bytes);
+
+        ArchiveNode{ bytes }.ExtractRecursive(levelDir);
+
+        reporter.Report("Ok", task.Key);
+      }
+    }, ParallelForOptions{ 1, Options.ThreadCount });
+
+    reporter.Log("Unpacking finished successfully!\n");
+
+    return 1;
+  }
+
+  U32 Packer::UnpackLevel(const PackerOptions& Options, const std::string& SourceName, const std::string& UnpackDir, const std::string& LevelName)
+  {
+    fs::path levelDir = Options.UnpackDir / SourceName / UnpackDir / LevelName;
+
+    if (fs::is_directory(levelDir) && !fs::is_empty(levelDir))
+    {
+      return 1;
+    }
+
+    if (!Options.Sources->HasMember(SourceName.c_str()))
+    {
+      return 0;
+    }
+
+    // Only the archives whose selected name matches the level are read, they are all
+    // extracted next to the level and moved in place at once, so an interrupted unpack
+    // never looks complete
+
+    std::vector<UnpackTask> tasks = {};
+
+    for (const auto& unpackEntry : (*Options.Sources)[SourceName.c_str()].GetArray())
+    {
+      fs::path sourceDir = Options.DataDir / unpackEntry["sourceDir"].GetString();
+
+      if (unpackEntry["unpackDir"].GetString() != UnpackDir || !fs::exists(sourceDir))
+      {
+        continue;
+      }
+
+      std::set<std::string> extensions = JsonUtils::ToStringSet(unpackEntry["extensions"].GetArray());
+
+      for (const auto& file : fs::directory_iterator{ sourceDir })
+      {
+        if (extensions.contains(file.path().extension().string()) && StringUtils::SelectExpr(file.path().stem().string(), unpackEntry["selectExpr"].GetString()) == LevelName)
+        {
+          tasks.emplace_back(UnpackTask{ file.path(), RelativeKey(file.path(), Options.DataDir) });
+        }
+      }
+    }
+
+    if (tasks.empty())
+    {
+      return 0;
+    }
+
+    std::sort(tasks.begin(), tasks.end(), [](const UnpackTask& A, const UnpackTask& B) { return A.File < B.File; });
+
+    fs::path partialDir = levelDir;
+
+    partialDir += ".partial";
+
+    fs::remove_all(partialDir);
+    fs::create_directories(partialDir);
+
+    ProgressReporter reporter = { Options, "unpack", (U32)tasks.size() };
+
+    BlowFish cypher = { Options.EncryptionKey };
+
+    for (const auto& task : tasks)
+    {
+      std::vector<U8> bytes = FileUtils::ReadBinary(task.File.string());
+
+      cypher.Decrypt(bytes);
+
+      ArchiveNode{ bytes }.ExtractRecursive(partialDir);
+
+      reporter.Report("Ok", task.Key);
+    }
+
+    fs::remove_all(levelDir);
+    fs::rename(partialDir, levelDir);
+
+    return 1;
+  }
+
+  U32 Packer::Repack(const PackerOptions& Options)
+  {
+    ProgressReporter reporter = { Options, "repack", 0 };
+
+    reporter.Log("Repacking, please wait...");
+    reporter.Log("Repacking is not supported yet!\n");
+
+    return 0;
+  }
+
+  U32 Packer::CheckIntegrity(const PackerOptions& Options)
+  {
+    std::atomic<U32> success = 1;
+    std::vector<fs::path> files = {};
+
+    if (!CollectDataFiles(Options, files))
+    {
+      ProgressReporter{ Options, "verify", 0 }.Log("Data directory could not be read!\n");
+
+      return 0;
+    }
+
+    rj::Document integrity = {};
+
+    integrity.Parse(FileUtils::ReadText(Options.IntegrityFile.string()).c_str());
+
+    ProgressReporter reporter = { Options, "verify", (U32)files.size() };
+
+    reporter.Log("Checking integrity, please wait...");
+
+    JobSystem::ParallelFor((U32)files.size(), [&](U32 Index)
+    {
+      std::string keyValue = RelativeKey(files[Index], Options.DataDir);
+
+      U32 currCrc32 = Crc32::FromBytes(FileUtils::ReadBinary(files[Index].string()));
+
+      if (!integrity.IsObject() || !integrity.HasMember(keyValue.c_str()))
+      {
+        success = 0;
+
+        reporter.Report("Missing", keyValue, currCrc32);
+      }
+      else if (integrity[keyValue.c_str()].GetUint() != currCrc32)
+      {
+        success = 0;
+
+        reporter.Report("Failed", keyValue, currCrc32);
+      }
+      else
+      {
+        reporter.Report("Ok", keyValue, currCrc32);
+      }
+    }, ParallelForOptions{ 1, Options.ThreadCount });
+
+    reporter.Log((success) ? "Integrity check successful!\n" : "Integrity check unsuccessful!\n");
+
+    return success;
+  }
+
+  U32 Packer::GenerateIntegrityMap(const PackerOptions& Options)
+  {
+    std::vector<fs::path> files = {};
+
+    if (!CollectDataFiles(Options, files))
+    {
+      ProgressReporter{ Options, "gen-integrity", 0 }.Log("Data directory could not be read!\n");
+
+      return 0;
+    }
+
+    std::vector<U32> crcs = std::vector<U32>(files.size(), 0);
+
+    ProgressReporter reporter = { Options, "gen-integrity", (U32)files.size() };
+
+    reporter.Log("Generating integrity, please wait...");
+
+    JobSystem::ParallelFor((U32)files.size(), [&](U32 Index)
+    {
+      crcs[Index] = Crc32::FromBytes(FileUtils::ReadBinary(files[Index].string()));
+
+      reporter.Report("Ok", RelativeKey(files[Index], Options.DataDir), crcs[Index]);
+    }, ParallelForOptions{ 1, Options.ThreadCount });
+
+    rj::Document document;
+    rj::Value integrities = rj::Value{ rj::kObjectType };
+    rj::StringBuffer buffer;
+    rj::PrettyWriter<rj::StringBuffer> writer = rj::PrettyWriter<rj::StringBuffer>{ buffer };
+
+    for (U32 i = 0; i < files.size(); i++)
+    {
+      std::string keyValue = RelativeKey(files[i], Options.DataDir);
+
+      integrities.AddMember(
+        rj::Value{ rj::kStringType }.SetString(keyValue.c_str(), document.GetAllocator()),
+        rj::Value{ rj::kNumberType }.SetUint(crcs[i]),
+        document.GetAllocator());
+    }
+
+    integrities.Accept(writer);
+
+    FileUtils::WriteText(Options.IntegrityFile.string(), buffer.GetString());
+
+    reporter.Log("Integrity generated successfully!\n");
+
+    return 1;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <filesystem>
+
+#include <Common/Types.h>
+
+#include <Vendor/rapidjson/rapidjson.h>
+#include <Vendor/rapidjson/document.h>
+
+///////////////////////////////////////////////////////////
+// Namespaces
+///////////////////////////////////////////////////////////
+
+namespace fs = std::filesystem;
+namespace rj = rapidjson;
+
+///////////////////////////////////////////////////////////
+// Definition
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  struct PackerProgress
+  {
+    const char* Operation;
+    const char* Status;
+    std::string File;
+    U32 Index;
+    U32 Count;
+    U32 Crc32;
+  };
+
+  struct PackerOptions
+  {
+    fs::path DataDir = {};
+    fs::path UnpackDir = {};
+    fs::path IntegrityFile = "Integrity.json";
+
+    std::string EncryptionKey = {};
+    const rj::Value* Sources = nullptr;
+
+    U32 ThreadCount = 1;
+    std::string Filter = {};
+
+    std::function<void(const PackerProgress&)> Progress = nullptr;
+  };
+
+  /*
+   * Unpacking and integrity operations over the game data directory.
+   *
+   * Every operation first collects the files it works on, optionally narrowed down
+   * by a substring filter on their path relative to the data directory, and then
+   * processes them on the requested number of threads. Each processed file is
+   * reported through the progress callback, by default as a log line. Single levels
+   * can be unpacked on their own, which is skipped when they were unpacked before.
+   */
+  class Packer
+  {
+  public:
+
+    static PackerOptions FromConfig(const rj::Value& Config, const rj::Value& Packer);
+
+  public:
+
+    static U32 Unpack(const PackerOptions& Options);
+    static U32 UnpackLevel(const PackerOptions& Options, const std::string& SourceName, const std::string& UnpackDir, const std::string& LevelName);
+    static U32 Repack(const PackerOptions& Options);
+
+  public:
+
+    static U32 CheckIntegrity(const PackerOptions& Options);
+    static U32 GenerateIntegrityMap(const PackerOptions& Options);
+  };
+}
\ No newline at end of file
@@ -60,6 +60,11 @@ namespace ark
     }
   }
 
+  bool ArchiveNode::IsKnownType(const std::string& Type)
+  {
+    return sKnownTypes.contains(Type);
+  }
+
   void ArchiveNode::ExtractRecursive(const fs::path& File, ArchiveNode* Node)
   {
     if (!Node)
@@ -69,6 +74,13 @@ namespace ark
 
     if (Node->IsArchive())
     {
+      // Texture packages are kept as a whole as well, models refer to their DDS by index
+
+      if (Node->GetType() == "DDP")
+      {
+        WriteFile(File, Node);
+      }
+
       for (const auto& [type, node] : *Node)
       {
         ExtractRecursive(File, node);
@@ -76,33 +88,38 @@ namespace ark
     }
     else
     {
-      fs::path fileWithName = File;
+      WriteFile(File, Node);
+    }
+  }
 
-      if (Node->GetName() == "")
-      {
-        fileWithName /= std::to_string(Node->GetCrc32());
-      }
-      else
-      {
-        fileWithName /= Node->GetName();
-      }
+  void ArchiveNode::WriteFile(const fs::path& File, ArchiveNode* Node)
+  {
+    fs::path fileWithName = File;
+
+    if (Node->GetName() == "")
+    {
+      fileWithName /= std::to_string(Node->GetCrc32());
+    }
+    else
+    {
+      fileWithName /= Node->GetName();
+    }
 
-      std::string fileWithNameAndExtension = fileWithName.string() + "." + Node->GetType();
+    std::string fileWithNameAndExtension = fileWithName.string() + "." + Node->GetType();
 
-      if (Node->GetSize())
+    if (Node->GetSize())
+    {
+      if (fs::exists(fileWithNameAndExtension))
       {
-        if (fs::exists(fileWithNameAndExtension))
-        {
-          if (Node->GetSize() > fs::file_size(fileWithNameAndExtension))
-          {
-            FileUtils::WriteBinary(fileWithNameAndExtension, Node->GetBytes());
-          }
-        }
-        else
+        if (Node->GetSize() > fs::file_size(fileWithNameAndExtension))
         {
           FileUtils::WriteBinary(fileWithNameAndExtension, Node->GetBytes());
         }
       }
+      else
+      {
+        FileUtils::WriteBinary(fileWithNameAndExtension, Node->GetBytes());
+      }
     }
   }
 
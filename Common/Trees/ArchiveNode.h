@@ -63,12 +63,17 @@ namespace ark
     inline auto end() { return mNodes.end(); }
     inline const auto end() const { return mNodes.cend(); }
 
+  public:
+
+    static bool IsKnownType(const std::string& Type);
+
   public:
 
     void ExtractRecursive(const fs::path& File, ArchiveNode* Node = nullptr);
 
   private:
 
+    void WriteFile(const fs::path& File, ArchiveNode* Node);
     void FetchHeader();
     bool ContainsArchive();
 
@@ -1,3 +1,6 @@
+#include <memory>
+#include <system_error>
+
 #include <Common/Trees/FileNode.h>
 
 ///////////////////////////////////////////////////////////
@@ -6,24 +9,256 @@
 
 namespace ark
 {
-  FileNode::FileNode(const fs::path& File)
+  FileNode::FileNode(const fs::path& File, FileWatcher* Watcher)
     : mFile{ File }
+    , mWatcher{ Watcher }
   {
-    if (fs::is_directory(mFile))
+    std::error_code error = {};
+
+    mIsDirectory = fs::is_directory(mFile, error);
+    mSize = mIsDirectory ? 0 : fs::file_size(mFile, error);
+
+    if (error)
     {
-      for (const auto file : fs::directory_iterator{ mFile })
+      mSize = 0;
+    }
+
+    Expand();
+  }
+
+  FileNode::FileNode(const FileNodeEntry& Entry, FileWatcher* Watcher)
+    : mFile{ Entry.File }
+    , mIsDirectory{ Entry.IsDirectory }
+    , mSize{ Entry.Size }
+    , mWatcher{ Watcher }
+  {
+
+  }
+
+  FileNode::~FileNode()
+  {
+    // Pending merges of this node are skipped from now on
+
+    mToken.Cancel();
+
+    if (mWatcher && mState != eFileNodeStateUnscanned)
+    {
+      mWatcher->Unwatch(mFile);
+    }
+
+    for (auto& [file, node] : mNodes)
+    {
+      delete node;
+      node = nullptr;
+    }
+  }
+
+  void FileNode::Expand()
+  {
+    if (mIsDirectory && mState == eFileNodeStateUnscanned)
+    {
+      // Watched before the listing starts, changes made while it runs cause a rescan rather than being lost
+
+      if (mWatcher)
       {
-        mNodes[file] = new FileNode{ file };
+        mWatcher->Watch(mFile);
       }
+
+      Scan();
     }
   }
 
-  FileNode::~FileNode()
+  void FileNode::Refresh()
+  {
+    if (!mIsDirectory || mState == eFileNodeStateUnscanned)
+    {
+      return;
+    }
+
+    if (mState == eFileNodeStateScanning)
+    {
+      mRescan = 1;
+    }
+    else
+    {
+      Scan();
+    }
+
+    for (auto& [file, node] : mNodes)
+    {
+      node->Refresh();
+    }
+  }
+
+  FileNode* FileNode::Find(const fs::path& File)
+  {
+    fs::path relative = File.lexically_relative(mFile);
+
+    if (relative.empty() || *relative.begin() == "..")
+    {
+      return nullptr;
+    }
+
+    FileNode* node = this;
+
+    for (const auto& part : relative)
+    {
+      if (part == ".")
+      {
+        continue;
+      }
+
+      auto it = node->mNodes.find(node->mFile / part);
+
+      if (it == node->mNodes.end())
+      {
+        return nullptr;
+      }
+
+      node = it->second;
+    }
+
+    return node;
+  }
+
+  void FileNode::Apply(const FileEvent& Event)
+  {
+    if (Event.Type == eFileEventOverflow)
+    {
+      Refresh();
+
+      return;
+    }
+
+    FileNode* parent = Find(Event.File.parent_path());
+
+    // Directories never listed pick the change up once expanded, running scans are
+    // simply repeated since their result might predate the event
+
+    if (!parent || parent->mState == eFileNodeStateUnscanned)
+    {
+      return;
+    }
+
+    if (parent->mState == eFileNodeStateScanning)
+    {
+      parent->mRescan = 1;
+
+      return;
+    }
+
+    auto it = parent->mNodes.find(Event.File);
+
+    if (Event.Type == eFileEventDeleted)
+    {
+      if (it != parent->mNodes.end())
+      {
+        delete it->second;
+
+        parent->mNodes.erase(it);
+
+        sRevision++;
+      }
+
+      return;
+    }
+
+    std::error_code error = {};
+
+    U32 isDirectory = fs::is_directory(Event.File, error);
+    U64 size = isDirectory ? 0 : fs::file_size(Event.File, error);
+
+    if (error)
+    {
+      return;
+    }
+
+    if (it != parent->mNodes.end() && it->second->mIsDirectory == isDirectory)
+    {
+      it->second->mSize = size;
+    }
+    else
+    {
+      if (it != parent->mNodes.end())
+      {
+        delete it->second;
+
+        parent->mNodes.erase(it);
+      }
+
+      parent->mNodes.emplace(Event.File, new FileNode{ FileNodeEntry{ Event.File, isDirectory, size }, mWatcher });
+    }
+
+    sRevision++;
+  }
+
+  void FileNode::Scan()
   {
+    mState = eFileNodeStateScanning;
+
+    sRevision++;
+
+    auto entries = std::make_shared<std::vector<FileNodeEntry>>();
+
+    JobHandle scan = JobSystem::Schedule([File = mFile, entries]()
+    {
+      std::error_code error = {};
+
+      for (auto it = fs::directory_iterator{ File, fs::directory_options::skip_permission_denied, error }; !error && it != fs::directory_iterator{}; it.increment(error))
+      {
+        std::error_code statusError = {};
+
+        U32 isDirectory = it->is_directory(statusError);
+        U64 size = isDirectory ? 0 : it->file_size(statusError);
+
+        entries->emplace_back(FileNodeEntry{ it->path(), isDirectory, statusError ? 0 : size });
+      }
+    });
+
+    JobSystem::Schedule([this, entries]()
+    {
+      Merge(*entries);
+    }, { scan }, eJobAffinityMain, &mToken);
+  }
+
+  void FileNode::Merge(std::vector<FileNodeEntry>& Entries)
+  {
+    std::map<fs::path, FileNode*> nodes = {};
+
+    for (auto& entry : Entries)
+    {
+      auto it = mNodes.find(entry.File);
+
+      if (it != mNodes.end() && it->second->mIsDirectory == entry.IsDirectory)
+      {
+        it->second->mSize = entry.Size;
+
+        nodes.emplace(entry.File, it->second);
+
+        mNodes.erase(it);
+      }
+      else
+      {
+        nodes.emplace(entry.File, new FileNode{ entry, mWatcher });
+      }
+    }
+
     for (auto& [file, node] : mNodes)
     {
       delete node;
       node = nullptr;
     }
+
+    mNodes = std::move(nodes);
+    mState = eFileNodeStateScanned;
+
+    sRevision++;
+
+    if (mRescan)
+    {
+      mRescan = 0;
+
+      Scan();
+    }
   }
 }
\ No newline at end of file
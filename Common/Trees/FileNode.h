@@ -2,8 +2,11 @@
 
 #include <filesystem>
 #include <map>
+#include <vector>
 
 #include <Common/Types.h>
+#include <Common/FileWatcher.h>
+#include <Common/JobSystem.h>
 
 ///////////////////////////////////////////////////////////
 // Namespaces
@@ -17,23 +20,58 @@ namespace fs = std::filesystem;
 
 namespace ark
 {
+  enum FileNodeState
+  {
+    eFileNodeStateUnscanned = 0,
+    eFileNodeStateScanning = 1,
+    eFileNodeStateScanned = 2,
+  };
+
+  struct FileNodeEntry
+  {
+    fs::path File;
+    U32 IsDirectory;
+    U64 Size;
+  };
+
+  /*
+   * Lazily scanned directory tree.
+   *
+   * Status and size are taken once from the directory entry and cached, so querying a
+   * node never touches the disk. Directories are only listed when expanded, on the job
+   * system, and the result is merged in by a main thread job. Refreshing re-lists the
+   * directories scanned so far and keeps nodes which still exist, including their
+   * children. Watcher events can be applied to the root instead, which only touches the
+   * nodes below the changed path. A tree given a watcher adds a watch for every directory
+   * once it is first listed and removes it with the node, so only directories which were
+   * expanded are ever watched. Every change of any tree bumps a shared revision,
+   * so views can cache what they built from it. Nodes must only be used from the main
+   * thread.
+   */
   class FileNode
   {
   public:
 
-    FileNode(const fs::path& File);
+    FileNode(const fs::path& File, FileWatcher* Watcher = nullptr);
+    FileNode(const FileNodeEntry& Entry, FileWatcher* Watcher);
     virtual ~FileNode();
 
   public:
 
-    inline auto IsDirectory() const { return fs::is_directory(mFile); }
-    inline auto IsFile() const { return fs::is_regular_file(mFile); }
+    inline auto IsDirectory() const { return mIsDirectory != 0; }
+    inline auto IsFile() const { return mIsDirectory == 0; }
+    inline auto IsScanning() const { return mState == eFileNodeStateScanning; }
+    inline auto IsScanned() const { return mState == eFileNodeStateScanned; }
 
     inline auto GetParent() const { return mFile.parent_path(); }
     inline auto GetPath() const { return mFile; }
     inline auto GetName() const { return mFile.stem(); }
     inline auto GetExtension() const { return mFile.extension(); }
-    inline auto GetSize() const { return fs::file_size(mFile); }
+    inline auto GetSize() const { return mSize; }
+
+  public:
+
+    inline static auto GetRevision() { return sRevision; }
 
   public:
 
@@ -43,9 +81,34 @@ namespace ark
     inline auto end() { return mNodes.end(); }
     inline const auto end() const { return mNodes.cend(); }
 
+  public:
+
+    void Expand();
+    void Refresh();
+
+    FileNode* Find(const fs::path& File);
+    void Apply(const FileEvent& Event);
+
+  private:
+
+    void Scan();
+    void Merge(std::vector<FileNodeEntry>& Entries);
+
+  private:
+
+    static inline U64 sRevision = 0;
+
   private:
 
     fs::path mFile;
+    U32 mIsDirectory = 0;
+    U64 mSize = 0;
+
+    FileWatcher* mWatcher;
+
+    FileNodeState mState = eFileNodeStateUnscanned;
+    U32 mRescan = 0;
+    CancellationToken mToken = {};
 
     std::map<fs::path, FileNode*> mNodes = {};
   };
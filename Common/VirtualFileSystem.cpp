@@ -0,0 +1,415 @@
+#include <algorithm>
+#include <cstring>
+#include <set>
+
+#include <Common/Crc32.h>
+#include <Common/VirtualFileSystem.h>
+
+#include <Common/Trees/ArchiveNode.h>
+
+#include <Common/Utils/FileUtils.h>
+#include <Common/Utils/JsonUtils.h>
+#include <Common/Utils/StringUtils.h>
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static std::string NormalizePath(const fs::path& Path)
+  {
+    std::string path = Path.lexically_normal().generic_string();
+
+    while (!path.empty() && path.back() == '/')
+    {
+      path.pop_back();
+    }
+
+    return (path == ".") ? std::string{} : path;
+  }
+}
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  VirtualFileSystem::VirtualFileSystem(U64 CacheSize)
+    : mCacheSize{ CacheSize }
+  {
+
+  }
+
+  VirtualFileSystem::~VirtualFileSystem()
+  {
+
+  }
+
+  void VirtualFileSystem::SetCacheSize(U64 CacheSize)
+  {
+    std::lock_guard<std::mutex> lock{ mCacheMutex };
+
+    mCacheSize = CacheSize;
+  }
+
+  void VirtualFileSystem::MountDirectory(const fs::path& Dir)
+  {
+    std::lock_guard<std::mutex> lock{ mMutex };
+
+    mDirectories.emplace_back(Dir);
+  }
+
+  U32 VirtualFileSystem::MountArchives(const fs::path& DataDir, const std::string& EncryptionKey, const rj::Value& Sources)
+  {
+    std::lock_guard<std::mutex> lock{ mMutex };
+
+    U32 count = 0;
+
+    mCypher = std::make_unique<BlowFish>(EncryptionKey);
+
+    // Archives land in the directory Packer::Unpack would extract them to
+
+    for (auto it = Sources.MemberBegin(); it != Sources.MemberEnd(); it++)
+    {
+      std::string unpackEntryName = it->name.GetString();
+
+      for (const auto& unpackEntry : it->value.GetArray())
+      {
+        fs::path sourceDir = DataDir / unpackEntry["sourceDir"].GetString();
+
+        if (!fs::is_directory(sourceDir))
+        {
+          continue;
+        }
+
+        std::set<std::string> extensions = JsonUtils::ToStringSet(unpackEntry["extensions"].GetArray());
+        std::vector<fs::path> files = {};
+
+        for (const auto& file : fs::directory_iterator{ sourceDir })
+        {
+          if (file.is_regular_file() && extensions.contains(file.path().extension().string()))
+          {
+            files.emplace_back(file.path());
+          }
+        }
+
+        std::sort(files.begin(), files.end());
+
+        for (const auto& file : files)
+        {
+          std::string levelName = StringUtils::SelectExpr(file.stem().string(), unpackEntry["selectExpr"].GetString());
+          std::string dir = NormalizePath(fs::path{ unpackEntryName } / unpackEntry["unpackDir"].GetString() / levelName);
+
+          mArchiveDirectories[dir].Archives.emplace_back((U32)mArchives.size());
+          mArchives.emplace_back(VirtualArchive{ file, nullptr });
+
+          count++;
+        }
+      }
+    }
+
+    return count;
+  }
+
+  bool VirtualFileSystem::Exists(const fs::path& File)
+  {
+    std::string file = NormalizePath(File);
+
+    std::lock_guard<std::mutex> lock{ mMutex };
+
+    for (const auto& dir : mDirectories)
+    {
+      if (fs::is_regular_file(dir / file))
+      {
+        return true;
+      }
+    }
+
+    VirtualDirectory* directory = FindDirectory(NormalizePath(fs::path{ file }.parent_path()));
+
+    return directory && directory->Files.contains(fs::path{ file }.filename().string());
+  }
+
+  std::vector<std::string> VirtualFileSystem::List(const fs::path& Dir)
+  {
+    std::string dir = NormalizePath(Dir);
+    std::set<std::string> names = {};
+
+    std::lock_guard<std::mutex> lock{ mMutex };
+
+    for (const auto& root : mDirectories)
+    {
+      if (fs::is_directory(root / dir))
+      {
+        for (const auto& file : fs::directory_iterator{ root / dir })
+        {
+          if (file.is_regular_file())
+          {
+            names.emplace(file.path().filename().string());
+          }
+        }
+      }
+    }
+
+    if (VirtualDirectory* directory = FindDirectory(dir))
+    {
+      for (const auto& [name, file] : directory->Files)
+      {
+        names.emplace(name);
+      }
+    }
+
+    return std::vector<std::string>{ names.begin(), names.end() };
+  }
+
+  std::vector<U8> VirtualFileSystem::ReadBinary(const fs::path& File)
+  {
+    std::string file = NormalizePath(File);
+
+    VirtualFile virtualFile = {};
+
+    {
+      std::lock_guard<std::mutex> lock{ mMutex };
+
+      for (const auto& dir : mDirectories)
+      {
+        if (fs::is_regular_file(dir / file))
+        {
+          return FileUtils::ReadBinary((dir / file).string());
+        }
+      }
+
+      VirtualDirectory* directory = FindDirectory(NormalizePath(fs::path{ file }.parent_path()));
+
+      if (!directory)
+      {
+        return {};
+      }
+
+      auto it = directory->Files.find(fs::path{ file }.filename().string());
+
+      if (it == directory->Files.end())
+      {
+        return {};
+      }
+
+      virtualFile = it->second;
+    }
+
+    std::vector<U8> bytes = std::vector<U8>(virtualFile.Size);
+
+    ReadRange(virtualFile.Archive, virtualFile.Offset, virtualFile.Size, bytes.data());
+
+    return bytes;
+  }
+
+  VirtualDirectory* VirtualFileSystem::FindDirectory(const std::string& Dir)
+  {
+    auto it = mArchiveDirectories.find(Dir);
+
+    if (it == mArchiveDirectories.end())
+    {
+      return nullptr;
+    }
+
+    VirtualDirectory& directory = it->second;
+
+    if (!directory.Indexed)
+    {
+      for (U32 archive : directory.Archives)
+      {
+        VirtualArchive& virtualArchive = mArchives[archive];
+
+        virtualArchive.Mapping = std::make_unique<MemoryMappedFile>(virtualArchive.File.string());
+
+        IndexArchive(directory, archive, 0, virtualArchive.Mapping->GetSize());
+      }
+
+      directory.Indexed = 1;
+    }
+
+    return &directory;
+  }
+
+  bool VirtualFileSystem::IndexArchive(VirtualDirectory& Directory, U32 Archive, U64 Offset, U64 Size)
+  {
+    // Same checks and size rules as ArchiveNode, only the table of contents is ever read
+
+    if (Size < sizeof(U32))
+    {
+      return false;
+    }
+
+    U32 count = 0;
+
+    ReadRange(Archive, Offset, sizeof(U32), (U8*)&count);
+
+    if (count == 0 || count >= 4096 || (sizeof(U32) + count * 8ULL) > Size)
+    {
+      return false;
+    }
+
+    std::vector<U32> offsets = std::vector<U32>(count);
+    std::vector<char> types = std::vector<char>(count * 4);
+
+    ReadRange(Archive, Offset + sizeof(U32), count * sizeof(U32), (U8*)offsets.data());
+    ReadRange(Archive, Offset + sizeof(U32) + count * sizeof(U32), count * 4, (U8*)types.data());
+
+    std::vector<ArchiveEntry> toc = std::vector<ArchiveEntry>(count);
+
+    for (U32 i = 0; i < count; i++)
+    {
+      toc[i].Offset = offsets[i];
+      toc[i].Type = StringUtils::RemoveNulls(std::string{ &types[i * 4], 4 });
+
+      if (toc[i].Offset >= Size || toc[i].Offset < 20 || !ArchiveNode::IsKnownType(toc[i].Type))
+      {
+        return false;
+      }
+    }
+
+    for (U32 i = 0; i < count; i++)
+    {
+      char name[20] = {};
+
+      ReadRange(Archive, Offset + toc[i].Offset - 20, sizeof(name), (U8*)name);
+
+      toc[i].Name = StringUtils::RemoveNulls(std::string{ name, sizeof(name) });
+    }
+
+    for (U32 i = 1; i < count; i++)
+    {
+      toc[i - 1].Size = (toc[i].Offset > toc[i - 1].Offset + 24) ? (toc[i].Offset - toc[i - 1].Offset - 24) : 0;
+    }
+
+    U32 last = ((U32)Size - 1) - toc[count - 1].Offset;
+
+    toc[count - 1].Size = (last >= 24) ? (last - 24) : 0;
+
+    for (const auto& entry : toc)
+    {
+      U64 entryOffset = Offset + entry.Offset;
+
+      // Nested archives are flattened, texture packages are kept as a whole as well
+
+      if (IndexArchive(Directory, Archive, entryOffset, entry.Size) && entry.Type != "DDP")
+      {
+        continue;
+      }
+
+      if (entry.Size == 0)
+      {
+        continue;
+      }
+
+      std::string name = entry.Name;
+
+      if (name.empty())
+      {
+        std::vector<U8> bytes = std::vector<U8>(entry.Size);
+
+        ReadRange(Archive, entryOffset, entry.Size, bytes.data());
+
+        name = std::to_string(Crc32::FromBytes(bytes));
+      }
+
+      name += "." + entry.Type;
+
+      auto it = Directory.Files.find(name);
+
+      if (it == Directory.Files.end() || entry.Size > it->second.Size)
+      {
+        Directory.Files[name] = VirtualFile{ Archive, entryOffset, entry.Size };
+      }
+    }
+
+    return true;
+  }
+
+  void VirtualFileSystem::ReadRange(U32 Archive, U64 Offset, U64 Size, U8* Bytes)
+  {
+    std::shared_ptr<const std::vector<U8>> block = nullptr;
+
+    while (Size)
+    {
+      U64 blockIndex = Offset / sBlockSize;
+      U64 blockOffset = Offset % sBlockSize;
+
+      ReadBlock(Archive, blockIndex, block);
+
+      U64 available = (block->size() > blockOffset) ? (block->size() - blockOffset) : 0;
+      U64 count = std::min(Size, sBlockSize - blockOffset);
+
+      std::memcpy(Bytes, block->data() + std::min(blockOffset, (U64)block->size()), std::min(count, available));
+
+      if (count > available)
+      {
+        std::memset(Bytes + available, 0, count - available);
+      }
+
+      Bytes += count;
+      Offset += count;
+      Size -= count;
+    }
+  }
+
+  void VirtualFileSystem::ReadBlock(U32 Archive, U64 Block, std::shared_ptr<const std::vector<U8>>& Bytes)
+  {
+    U64 key = ((U64)Archive << 40) | Block;
+
+    {
+      std::lock_guard<std::mutex> lock{ mCacheMutex };
+
+      auto it = mBlocks.find(key);
+
+      if (it != mBlocks.end())
+      {
+        mLru.splice(mLru.begin(), mLru, it->second.second);
+
+        mCacheHits++;
+
+        Bytes = it->second.first;
+
+        return;
+      }
+
+      mCacheMisses++;
+    }
+
+    // Blocks are a multiple of the cypher block size, so each one decrypts on its own
+
+    const MemoryMappedFile& mapping = *mArchives[Archive].Mapping;
+
+    U64 begin = std::min(Block * sBlockSize, mapping.GetSize());
+    U64 end = std::min(begin + sBlockSize, mapping.GetSize());
+
+    std::vector<U8> bytes = std::vector<U8>(mapping.GetData() + begin, mapping.GetData() + end);
+
+    mCypher->Decrypt(bytes);
+
+    Bytes = std::make_shared<const std::vector<U8>>(std::move(bytes));
+
+    std::lock_guard<std::mutex> lock{ mCacheMutex };
+
+    if (mBlocks.contains(key))
+    {
+      return;
+    }
+
+    mLru.emplace_front(key);
+    mBlocks.emplace(key, std::make_pair(Bytes, mLru.begin()));
+    mCachedSize += Bytes->size();
+
+    while (mCachedSize > mCacheSize && mLru.size() > 1)
+    {
+      auto it = mBlocks.find(mLru.back());
+
+      mCachedSize -= it->second.first->size();
+
+      mBlocks.erase(it);
+      mLru.pop_back();
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <filesystem>
+
+#include <Common/Types.h>
+#include <Common/BlowFish.h>
+#include <Common/MemoryMappedFile.h>
+
+#include <Vendor/rapidjson/rapidjson.h>
+#include <Vendor/rapidjson/document.h>
+
+///////////////////////////////////////////////////////////
+// Namespaces
+///////////////////////////////////////////////////////////
+
+namespace fs = std::filesystem;
+namespace rj = rapidjson;
+
+///////////////////////////////////////////////////////////
+// Definition
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  struct VirtualFile
+  {
+    U32 Archive;
+    U64 Offset;
+    U32 Size;
+  };
+
+  struct VirtualArchive
+  {
+    fs::path File;
+    std::unique_ptr<MemoryMappedFile> Mapping;
+  };
+
+  struct VirtualDirectory
+  {
+    std::vector<U32> Archives;
+    std::map<std::string, VirtualFile> Files;
+    U32 Indexed;
+  };
+
+  /*
+   * Read-only view over unpacked directories and encrypted data archives.
+   *
+   * Archives are mounted under the same paths Packer::Unpack would extract them to,
+   * but nothing is read until a directory is first listed or read from. Its tables of
+   * contents are then walked through a shared cache of decrypted blocks, entries of
+   * nested archives are flattened into the directory like extraction does. Mounted
+   * directories on disk take precedence over archive entries of the same path.
+   */
+  class VirtualFileSystem
+  {
+  public:
+
+    static constexpr U64 sBlockSize = 65536;
+
+  public:
+
+    VirtualFileSystem(U64 CacheSize = 64ULL * 1024ULL * 1024ULL);
+    VirtualFileSystem(const VirtualFileSystem& Other) = delete;
+    virtual ~VirtualFileSystem();
+
+  public:
+
+    inline auto GetCacheHits() const { return mCacheHits; }
+    inline auto GetCacheMisses() const { return mCacheMisses; }
+
+  public:
+
+    void SetCacheSize(U64 CacheSize);
+
+  public:
+
+    void MountDirectory(const fs::path& Dir);
+    U32 MountArchives(const fs::path& DataDir, const std::string& EncryptionKey, const rj::Value& Sources);
+
+  public:
+
+    bool Exists(const fs::path& File);
+    std::vector<std::string> List(const fs::path& Dir);
+    std::vector<U8> ReadBinary(const fs::path& File);
+
+  private:
+
+    VirtualDirectory* FindDirectory(const std::string& Dir);
+
+    bool IndexArchive(VirtualDirectory& Directory, U32 Archive, U64 Offset, U64 Size);
+
+    void ReadRange(U32 Archive, U64 Offset, U64 Size, U8* Bytes);
+    void ReadBlock(U32 Archive, U64 Block, std::shared_ptr<const std::vector<U8>>& Bytes);
+
+  private:
+
+    std::vector<fs::path> mDirectories = {};
+
+    std::vector<VirtualArchive> mArchives = {};
+    std::map<std::string, VirtualDirectory> mArchiveDirectories = {};
+
+    std::unique_ptr<BlowFish> mCypher = nullptr;
+
+    std::mutex mMutex = {};
+
+    std::mutex mCacheMutex = {};
+    std::list<U64> mLru = {};
+    std::unordered_map<U64, std::pair<std::shared_ptr<const std::vector<U8>>, std::list<U64>::iterator>> mBlocks = {};
+    U64 mCacheSize;
+    U64 mCachedSize = 0;
+    U64 mCacheHits = 0;
+    U64 mCacheMisses = 0;
+  };
+}
\ No newline at end of file
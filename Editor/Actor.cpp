@@ -1,4 +1,5 @@
 #include <Editor/Actor.h>
+#include <Editor/Scene.h>
 
 #include <Editor/Components/Transform.h>
 
@@ -8,19 +9,24 @@
 
 namespace ark
 {
-  Actor::Actor(const std::string& Name)
-    : mName{ Name }
-    , mTransform{ AttachComponent<Transform>() }
+  Actor::Actor(Scene* Scene, const std::string& Name)
+    : mScene{ Scene }
+    , mRegistry{ &Scene->GetRegistry() }
+    , mEntity{ mRegistry->CreateEntity() }
+    , mName{ Name }
   {
-
+    AttachComponent<Transform>();
   }
 
   Actor::~Actor()
   {
-    for (auto& [hash, component] : mComponents)
-    {
-      delete component;
-      component = nullptr;
-    }
+    mRegistry->DestroyEntity(mEntity);
+  }
+
+  void Actor::SetParent(Actor* Parent)
+  {
+    mParent = Parent;
+
+    GetTransform()->SetParent((Parent) ? Parent->GetTransform() : nullptr);
   }
 }
\ No newline at end of file
@@ -2,13 +2,14 @@
 
 #include <string>
 #include <vector>
-#include <map>
-#include <typeinfo>
 #include <algorithm>
 
 #include <Common/Types.h>
 
 #include <Editor/Forward.h>
+#include <Editor/Registry.h>
+
+#include <Editor/Components/Transform.h>
 
 ///////////////////////////////////////////////////////////
 // Definition
@@ -20,7 +21,7 @@ namespace ark
   {
   public:
 
-    Actor(const std::string& Name);
+    Actor(Scene* Scene, const std::string& Name);
     virtual ~Actor();
 
   public:
@@ -38,15 +39,16 @@ namespace ark
     inline auto HasChildren() const { return mChildren.size() > 0; }
 
     inline const auto& GetName() const { return mName; }
-    inline const auto& GetComponents() const { return mComponents; }
     inline const auto& GetChildren() const { return mChildren; }
 
+    inline auto GetScene() const { return mScene; }
+    inline auto GetEntity() const { return mEntity; }
     inline auto GetParent() const { return mParent; }
-    inline auto GetTransform() const { return mTransform; }
+    inline auto GetTransform() const { return mRegistry->Get<Transform>(mEntity); }
 
   public:
 
-    inline void SetParent(Actor* Parent) { mParent = Parent; }
+    void SetParent(Actor* Parent);
 
   public:
 
@@ -63,16 +65,17 @@ namespace ark
     C* AttachComponent(Args&& ... Arguments);
 
     template<typename C>
-    C* GetComponent();
+    C* GetComponent() const;
 
   private:
 
+    Scene* mScene;
+    Registry* mRegistry;
+    Entity mEntity;
     std::string mName;
     std::vector<Actor*> mChildren;
-    std::map<U64, Component*> mComponents;
 
     Actor* mParent = nullptr;
-    Transform* mTransform = nullptr;
   };
 }
 
@@ -85,19 +88,12 @@ namespace ark
   template<typename C, typename ... Args>
   C* Actor::AttachComponent(Args&& ... Arguments)
   {
-    U64 hash = typeid(C).hash_code();
-    auto const findIt = mComponents.find(hash);
-    if (findIt == mComponents.end())
-    {
-      auto const [emplaceIt, inserted] = mComponents.emplace(hash, new C{ this, std::forward<Args>(Arguments) ... });
-      return (C*)emplaceIt->second;
-    }
-    return (C*)findIt->second;
+    return mRegistry->Emplace<C>(mEntity, this, std::forward<Args>(Arguments) ...);
   }
 
   template<typename C>
-  C* Actor::GetComponent()
+  C* Actor::GetComponent() const
   {
-    return (C*)mComponents[typeid(C).hash_code()];
+    return mRegistry->Get<C>(mEntity);
   }
 }
\ No newline at end of file
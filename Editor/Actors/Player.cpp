@@ -11,11 +11,10 @@
 
 namespace ark
 {
-  Player::Player(std::string const& Name)
-    : Actor{ Name }
-    , mCamera{ AttachComponent<Camera>() }
+  Player::Player(Scene* Scene, std::string const& Name)
+    : Actor{ Scene, Name }
   {
-
+    AttachComponent<Camera>();
   }
 
   void Player::Update(R32 TimeDelta)
@@ -17,7 +17,7 @@ namespace ark
   {
   public:
 
-    Player(std::string const& Name);
+    Player(Scene* Scene, std::string const& Name);
 
   public:
 
@@ -25,8 +25,6 @@ namespace ark
 
   private:
 
-    Camera* mCamera;
-
     R32 mKeyboardMovementSpeedNormal = 0.05F;
     R32 mKeyboardMovementSpeedFast = 2.0F;
 
@@ -6,6 +6,13 @@
 
 namespace ark
 {
+  ModelDivision::ModelDivision(std::pmr::memory_resource* Resource)
+    : mVertexBuffer{ Resource }
+    , mElementBuffer{ Resource }
+  {
+
+  }
+
   ModelEntry::ModelEntry(U32 Id, U32 Type)
     : mId{ Id }
     , mType{ Type }
@@ -2,6 +2,8 @@
 
 #include <string>
 #include <vector>
+#include <utility>
+#include <memory_resource>
 
 #include <Common/Types.h>
 
@@ -13,25 +15,54 @@
 
 namespace ark
 {
+  /*
+   * Divisions are move only, their buffers are allocated from the memory resource
+   * they were created with, usually the arena of the owning scene.
+   */
   class ModelDivision
   {
   public:
 
+    ModelDivision(std::pmr::memory_resource* Resource = std::pmr::get_default_resource());
+    ModelDivision(const ModelDivision& Other) = delete;
+    ModelDivision(ModelDivision&& Other) noexcept = default;
+
+  public:
+
+    ModelDivision& operator = (const ModelDivision& Other) = delete;
+    ModelDivision& operator = (ModelDivision&& Other) noexcept = default;
+
+  public:
+
+    inline auto& GetVertexBuffer() { return mVertexBuffer; }
     inline const auto& GetVertexBuffer() const { return mVertexBuffer; }
+
+    inline auto& GetElementBuffer() { return mElementBuffer; }
     inline const auto& GetElementBuffer() const { return mElementBuffer; }
 
     inline auto GetVertexCount() const { return mVertexBuffer.size(); }
     inline auto GetElementCount() const { return mElementBuffer.size(); }
+    inline auto GetTextureIndex() const { return mTextureIndex; }
+
+  public:
+
+    inline void SetTextureIndex(U16 Value) { mTextureIndex = Value; }
+
+    inline void SetVertexBuffer(const DefaultVertex* Values, U64 Count) { mVertexBuffer.assign(Values, Values + Count); }
+    inline void SetElementBuffer(const U16* Values, U64 Count) { mElementBuffer.assign(Values, Values + Count); }
 
   public:
 
-    inline void AddVertex(const DefaultVertex& Value) { mVertexBuffer.emplace_back(Value); }
+    inline void ResizeVertices(U64 Value) { mVertexBuffer.resize(Value); }
+    inline void ReserveElements(U64 Value) { mElementBuffer.reserve(Value); }
     inline void AddElement(U16 Value) { mElementBuffer.emplace_back(Value); }
 
   private:
 
-    std::vector<DefaultVertex> mVertexBuffer = {};
-    std::vector<U32> mElementBuffer = {};
+    std::pmr::vector<DefaultVertex> mVertexBuffer;
+    std::pmr::vector<U16> mElementBuffer;
+
+    U16 mTextureIndex = 0;
   };
 
   class ModelEntry
@@ -39,6 +70,13 @@ namespace ark
   public:
 
     ModelEntry(U32 Id, U32 Type);
+    ModelEntry(const ModelEntry& Other) = delete;
+    ModelEntry(ModelEntry&& Other) noexcept = default;
+
+  public:
+
+    ModelEntry& operator = (const ModelEntry& Other) = delete;
+    ModelEntry& operator = (ModelEntry&& Other) noexcept = default;
 
   public:
 
@@ -61,7 +99,9 @@ namespace ark
 
   public:
 
-    inline void AddDivision(const ModelDivision& Value) { mDivisions.emplace_back(Value); }
+    inline void ReserveDivisions(U64 Value) { mDivisions.reserve(Value); }
+
+    inline auto& AddDivision(ModelDivision&& Value) { return mDivisions.emplace_back(std::move(Value)); }
 
   public:
 
@@ -93,6 +133,13 @@ namespace ark
   public:
 
     ModelGroup(const std::string& Name);
+    ModelGroup(const ModelGroup& Other) = delete;
+    ModelGroup(ModelGroup&& Other) noexcept = default;
+
+  public:
+
+    ModelGroup& operator = (const ModelGroup& Other) = delete;
+    ModelGroup& operator = (ModelGroup&& Other) noexcept = default;
 
   public:
 
@@ -103,7 +150,9 @@ namespace ark
 
   public:
 
-    inline void AddEntry(const ModelEntry& Value) { mEntries.emplace_back(Value); }
+    inline void ReserveEntries(U64 Value) { mEntries.reserve(Value); }
+
+    inline auto& AddEntry(ModelEntry&& Value) { return mEntries.emplace_back(std::move(Value)); }
 
   public:
 
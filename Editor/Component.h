@@ -8,6 +8,14 @@
 
 namespace ark
 {
+  enum ComponentType
+  {
+    eComponentTypeTransform,
+    eComponentTypeCamera,
+    eComponentTypeRenderable,
+    eComponentTypeCount,
+  };
+
   class Component
   {
   public:
@@ -15,6 +23,10 @@ namespace ark
     Component(Actor* Actor);
     virtual ~Component();
 
+  public:
+
+    inline auto GetActor() const { return mActor; }
+
   protected:
 
     Actor* mActor;
@@ -13,6 +13,10 @@ namespace ark
 {
   class Camera : public Component
   {
+  public:
+
+    static constexpr ComponentType Type = eComponentTypeCamera;
+
   public:
 
     Camera(Actor* Actor);
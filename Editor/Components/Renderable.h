@@ -17,21 +17,27 @@ namespace ark
 {
   class Renderable : public Component
   {
+  public:
+
+    static constexpr ComponentType Type = eComponentTypeRenderable;
+
   public:
 
     Renderable(Actor* Actor);
 
   public:
 
-    inline auto GetMeshPtr() const { return &mMesh; }
+    inline auto GetMeshPtr() const { return mMesh; }
+    inline auto GetTexturePtr() const { return mTexture; }
 
   public:
 
-    inline void SetVertexBuffer(const std::vector<DefaultVertex>& Value) { mMesh.UploadVertices(&Value[0], (U32)Value.size()); }
-    inline void SetElementBuffer(const std::vector<U32>& Value) { mMesh.UploadElements(&Value[0], (U32)Value.size()); }
+    inline void SetMesh(const Mesh<DefaultVertex, U16>* Value) { mMesh = Value; }
+    inline void SetTexture(Texture* Value) { mTexture = Value; }
 
   private:
 
-    Mesh<DefaultVertex, U32> mMesh = {};
+    const Mesh<DefaultVertex, U16>* mMesh = nullptr;
+    Texture* mTexture = nullptr;
   };
 }
\ No newline at end of file
@@ -1,9 +1,53 @@
+#include <utility>
+
 #include <Editor/Actor.h>
+#include <Editor/Hierarchy.h>
+#include <Editor/Scene.h>
 
 #include <Editor/Components/Transform.h>
 
 #include <Vendor/GLM/gtc/matrix_transform.hpp>
 
+#define GLM_ENABLE_EXPERIMENTAL
+#include <Vendor/GLM/gtx/euler_angles.hpp>
+#undef GLM_ENABLE_EXPERIMENTAL
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static R32V3 ScaleOf(const R32M4& Matrix)
+  {
+    return R32V3{ glm::length(R32V3{ Matrix[0] }), glm::length(R32V3{ Matrix[1] }), glm::length(R32V3{ Matrix[2] }) };
+  }
+
+  static R32M4 RotationOf(const R32M4& Matrix)
+  {
+    R32V3 scale = ScaleOf(Matrix);
+
+    R32M4 rotation = glm::identity<R32M4>();
+
+    rotation[0] = R32V4{ R32V3{ Matrix[0] } / scale.x, 0.0F };
+    rotation[1] = R32V4{ R32V3{ Matrix[1] } / scale.y, 0.0F };
+    rotation[2] = R32V4{ R32V3{ Matrix[2] } / scale.z, 0.0F };
+
+    return rotation;
+  }
+
+  static R32V3 EulerOf(const R32M4& Rotation)
+  {
+    // Local matrices rotate around x, then y, then z, see Hierarchy::Update
+
+    R32V3 euler = {};
+
+    glm::extractEulerAngleXYZ(Rotation, euler.x, euler.y, euler.z);
+
+    return euler;
+  }
+}
+
 ///////////////////////////////////////////////////////////
 // Implementation
 ///////////////////////////////////////////////////////////
@@ -12,138 +56,197 @@ namespace ark
 {
   Transform::Transform(Actor* Actor)
     : Component{ Actor }
+    , mHierarchy{ &Actor->GetScene()->GetHierarchy() }
+    , mHandle{ mHierarchy->Allocate() }
   {
 
   }
 
-  R32M4 Transform::GetModelMatrix() const
+  Transform::Transform(Transform&& Other) noexcept
+    : Component{ Other }
+    , mHierarchy{ Other.mHierarchy }
+    , mHandle{ std::exchange(Other.mHandle, Hierarchy::sInvalidHandle) }
   {
-    R32M4 model = glm::identity<R32M4>();
 
-    model = glm::translate(model, mPosition);
-    model = glm::rotate(model, mRotation.x, mWorldRight);
-    model = glm::rotate(model, mRotation.y, mWorldUp);
-    model = glm::rotate(model, mRotation.z, mWorldFront);
-    model = glm::scale(model, mScale);
-
-    return model;
   }
 
-  R32V3 Transform::GetWorldPosition() const
+  Transform::~Transform()
   {
-    if (mActor->GetParent())
+    if (mHandle != Hierarchy::sInvalidHandle)
     {
-      return mActor->GetParent()->GetTransform()->GetWorldPosition() + mPosition;
-    }
-    else
-    {
-      return mPosition;
+      mHierarchy->Free(mHandle);
     }
   }
 
+  R32V3 Transform::GetLocalRight() const
+  {
+    return GetQuaternion() * mWorldRight;
+  }
+
+  R32V3 Transform::GetLocalUp() const
+  {
+    return GetQuaternion() * mWorldUp;
+  }
+
+  R32V3 Transform::GetLocalFront() const
+  {
+    return GetQuaternion() * mWorldFront;
+  }
+
+  R32V3 Transform::GetPosition() const
+  {
+    return mHierarchy->GetLocalPosition(mHandle);
+  }
+
+  R32V3 Transform::GetRotation() const
+  {
+    return glm::degrees(mHierarchy->GetLocalRotation(mHandle));
+  }
+
+  R32Q Transform::GetQuaternion() const
+  {
+    return R32Q{ mHierarchy->GetLocalRotation(mHandle) };
+  }
+
+  R32V3 Transform::GetScale() const
+  {
+    return mHierarchy->GetLocalScale(mHandle);
+  }
+
+  R32M4 Transform::GetModelMatrix() const
+  {
+    return mHierarchy->GetWorldMatrix(mHandle);
+  }
+
+  R32V3 Transform::GetWorldPosition() const
+  {
+    return R32V3{ mHierarchy->GetWorldMatrix(mHandle)[3] };
+  }
+
   R32V3 Transform::GetWorldRotation() const
   {
-    return glm::degrees(mRotation);
+    if (mHierarchy->GetParent(mHandle) == Hierarchy::sInvalidHandle)
+    {
+      return GetRotation();
+    }
+
+    return glm::degrees(EulerOf(RotationOf(mHierarchy->GetWorldMatrix(mHandle))));
   }
 
   R32Q Transform::GetWorldQuaternion() const
   {
-    return mRotation;
+    if (mHierarchy->GetParent(mHandle) == Hierarchy::sInvalidHandle)
+    {
+      return GetQuaternion();
+    }
+
+    return R32Q{ glm::radians(GetWorldRotation()) };
   }
 
   R32V3 Transform::GetWorldScale() const
   {
-    return mScale;
+    if (mHierarchy->GetParent(mHandle) == Hierarchy::sInvalidHandle)
+    {
+      return GetScale();
+    }
+
+    return ScaleOf(mHierarchy->GetWorldMatrix(mHandle));
+  }
+
+  void Transform::SetParent(Transform* Parent)
+  {
+    mHierarchy->SetParent(mHandle, (Parent) ? Parent->mHandle : Hierarchy::sInvalidHandle);
   }
 
   void Transform::SetWorldPosition(const R32V3& Position)
   {
-    mPosition = Position;
+    U32 parent = mHierarchy->GetParent(mHandle);
+
+    if (parent != Hierarchy::sInvalidHandle)
+    {
+      mHierarchy->SetLocalPosition(mHandle, R32V3{ glm::inverse(mHierarchy->GetWorldMatrix(parent)) * R32V4{ Position, 1.0F } });
+    }
+    else
+    {
+      mHierarchy->SetLocalPosition(mHandle, Position);
+    }
   }
 
   void Transform::SetWorldRotation(const R32V3& Rotation)
   {
-    mRotation = glm::radians(Rotation);
+    U32 parent = mHierarchy->GetParent(mHandle);
+
+    if (parent != Hierarchy::sInvalidHandle)
+    {
+      R32V3 radians = glm::radians(Rotation);
+      R32M4 parentRotation = RotationOf(mHierarchy->GetWorldMatrix(parent));
+
+      mHierarchy->SetLocalRotation(mHandle, EulerOf(glm::transpose(parentRotation) * glm::eulerAngleXYZ(radians.x, radians.y, radians.z)));
+    }
+    else
+    {
+      mHierarchy->SetLocalRotation(mHandle, glm::radians(Rotation));
+    }
   }
 
   void Transform::SetWorldScale(const R32V3& Scale)
   {
-    mScale = Scale;
+    U32 parent = mHierarchy->GetParent(mHandle);
+
+    // Exact as long as the parent scales uniformly or shares the orientation of this transform
+
+    if (parent != Hierarchy::sInvalidHandle)
+    {
+      mHierarchy->SetLocalScale(mHandle, Scale / ScaleOf(mHierarchy->GetWorldMatrix(parent)));
+    }
+    else
+    {
+      mHierarchy->SetLocalScale(mHandle, Scale);
+    }
   }
 
   void Transform::SetLocalPosition(const R32V3& Position)
   {
-    mPosition = Position;
+    mHierarchy->SetLocalPosition(mHandle, Position);
   }
 
   void Transform::SetLocalRotation(const R32V3& Rotation)
   {
-    mRotation = glm::radians(Rotation);
-
-    R32Q q = mRotation;
-    mLocalRight = q * mWorldRight;
-    mLocalUp = q * mWorldUp;
-    mLocalFront = q * mWorldFront;
-
-    for (auto child : mActor->GetChildren())
-    {
-      child->GetTransform()->SetLocalRotation(GetRotation());
-    }
+    mHierarchy->SetLocalRotation(mHandle, glm::radians(Rotation));
   }
 
   void Transform::SetLocalScale(const R32V3& Scale)
   {
-    mScale = Scale;
-
-    for (auto child : mActor->GetChildren())
-    {
-      child->GetTransform()->SetLocalScale(GetScale());
-    }
+    mHierarchy->SetLocalScale(mHandle, Scale);
   }
 
   void Transform::AddWorldPosition(const R32V3& Position)
   {
-    mPosition += Position;
+    SetWorldPosition(GetWorldPosition() + Position);
   }
 
   void Transform::AddWorldRotation(const R32V3& Rotation)
   {
-    mRotation += glm::radians(Rotation);
+    SetWorldRotation(GetWorldRotation() + Rotation);
   }
 
   void Transform::AddWorldScale(const R32V3& Scale)
   {
-    mScale += Scale;
+    SetWorldScale(GetWorldScale() + Scale);
   }
 
   void Transform::AddLocalPosition(const R32V3& Position)
   {
-    mPosition += Position;
+    mHierarchy->SetLocalPosition(mHandle, mHierarchy->GetLocalPosition(mHandle) + Position);
   }
 
   void Transform::AddLocalRotation(const R32V3& Rotation)
   {
-    mRotation += glm::radians(Rotation);
-
-    R32Q q = mRotation;
-    mLocalRight = q * mWorldRight;
-    mLocalUp = q * mWorldUp;
-    mLocalFront = q * mWorldFront;
-
-    for (auto child : mActor->GetChildren())
-    {
-      child->GetTransform()->SetLocalRotation(GetRotation());
-    }
+    mHierarchy->SetLocalRotation(mHandle, mHierarchy->GetLocalRotation(mHandle) + glm::radians(Rotation));
   }
 
   void Transform::AddLocalScale(const R32V3& Scale)
   {
-    mScale += Scale;
-
-    for (auto child : mActor->GetChildren())
-    {
-      child->GetTransform()->SetLocalScale(GetScale());
-    }
+    mHierarchy->SetLocalScale(mHandle, mHierarchy->GetLocalScale(mHandle) + Scale);
   }
-
-}
+}
\ No newline at end of file
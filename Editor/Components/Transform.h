@@ -13,9 +13,15 @@ namespace ark
 {
   class Transform : public Component
   {
+  public:
+
+    static constexpr ComponentType Type = eComponentTypeTransform;
+
   public:
 
     Transform(Actor* Actor);
+    Transform(Transform&& Other) noexcept;
+    virtual ~Transform();
 
   public:
 
@@ -23,16 +29,20 @@ namespace ark
     inline const auto& GetWorldUp() const { return mWorldUp; }
     inline const auto& GetWorldFront() const { return mWorldFront; }
 
-    inline const auto& GetLocalRight() const { return mLocalRight; }
-    inline const auto& GetLocalUp() const { return mLocalUp; }
-    inline const auto& GetLocalFront() const { return mLocalFront; }
+    R32V3 GetLocalRight() const;
+    R32V3 GetLocalUp() const;
+    R32V3 GetLocalFront() const;
+
+  public:
+
+    inline auto GetHandle() const { return mHandle; }
 
   public:
 
-    inline const auto& GetPosition() const { return mPosition; }
-    inline auto GetRotation() const { return glm::degrees(mRotation); }
-    inline auto GetQuaternion() const { return R32Q{ mRotation }; }
-    inline const auto& GetScale() const { return mScale; }
+    R32V3 GetPosition() const;
+    R32V3 GetRotation() const;
+    R32Q GetQuaternion() const;
+    R32V3 GetScale() const;
 
   public:
 
@@ -45,6 +55,10 @@ namespace ark
     R32Q GetWorldQuaternion() const;
     R32V3 GetWorldScale() const;
 
+  public:
+
+    void SetParent(Transform* Parent);
+
   public:
 
     void SetWorldPosition(const R32V3& Position);
@@ -71,12 +85,7 @@ namespace ark
     const R32V3 mWorldUp = { 0.0F, 1.0F, 0.0F };
     const R32V3 mWorldFront = { 0.0F, 0.0F, 1.0F };
 
-    R32V3 mLocalRight = { 1.0F, 0.0F, 0.0F };
-    R32V3 mLocalUp = { 0.0F, 1.0F, 0.0F };
-    R32V3 mLocalFront = { 0.0F, 0.0F, 1.0F };
-
-    R32V3 mPosition = { 0.0F, 0.0F, 0.0F };
-    R32V3 mRotation = { 0.0F, 0.0F, 0.0F };
-    R32V3 mScale = { 1.0F, 1.0F, 1.0F };
+    Hierarchy* mHierarchy;
+    U32 mHandle;
   };
 }
\ No newline at end of file
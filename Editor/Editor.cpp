@@ -2,13 +2,16 @@
 #include <filesystem>
 
 #include <Common/Debug.h>
+#include <Common/JobSystem.h>
 #include <Common/Types.h>
+#include <Common/VirtualFileSystem.h>
 
 #include <Common/Utils/FileUtils.h>
 
 #include <Editor/Actor.h>
 #include <Editor/Event.h>
 #include <Editor/Interface.h>
+#include <Editor/Profiler.h>
 #include <Editor/Scene.h>
 #include <Editor/Window.h>
 
@@ -21,6 +24,8 @@
 #include <Editor/Interface/AssetBrowser.h>
 #include <Editor/Interface/MainMenu.h>
 #include <Editor/Interface/FileInspector.h>
+#include <Editor/Interface/FrameProfiler.h>
+#include <Editor/Interface/LogConsole.h>
 #include <Editor/Interface/SceneOutline.h>
 
 #include <Vendor/GLAD/glad.h>
@@ -109,6 +114,8 @@ rj::Document gConfig = {};
 rj::Document gPacker = {};
 rj::Document gWorld = {};
 
+ark::VirtualFileSystem gFileSystem = {};
+
 std::vector<ark::Interface*> gInterfaces = {};
 
 ark::DebugRenderer* gDebugRenderer = nullptr;
@@ -132,7 +139,7 @@ static ark::R32 sTimeDelta = 0.0F;
 
 static void GlfwDebugProc(ark::I32 Error, char const* Msg)
 {
-  LOG("Error:%d Message:%s\n", Error, Msg);
+  LOG_ERROR("Error:%d Message:%s\n", Error, Msg);
 }
 
 static void GlfwResizeProc(GLFWwindow* Context, ark::I32 Width, ark::I32 Height)
@@ -147,6 +154,21 @@ static void GlfwMouseProc(GLFWwindow* Context, ark::R64 X, ark::R64 Y)
   ark::Event::SetMouseY((ark::R32)Y);
 }
 
+static void GlfwKeyProc(GLFWwindow* Context, ark::I32 Key, ark::I32 ScanCode, ark::I32 Action, ark::I32 Mods)
+{
+  ark::Event::QueueKey(Key, Action);
+}
+
+static void GlfwButtonProc(GLFWwindow* Context, ark::I32 Button, ark::I32 Action, ark::I32 Mods)
+{
+  ark::Event::QueueMouse(Button, Action);
+}
+
+static void GlfwScrollProc(GLFWwindow* Context, ark::R64 X, ark::R64 Y)
+{
+  ark::Event::QueueScroll((ark::R32)X, (ark::R32)Y);
+}
+
 ///////////////////////////////////////////////////////////
 // Gl Callbacks
 ///////////////////////////////////////////////////////////
@@ -156,9 +178,9 @@ static void GlDebugCallback(ark::U32 Source, ark::U32 Type, ark::U32 Id, ark::U3
   switch (Severity)
   {
     case GL_DEBUG_SEVERITY_NOTIFICATION: break;
-    case GL_DEBUG_SEVERITY_LOW: LOG("Severity:Low Type:0x%x Message:%s\n", Type, Msg); break;
-    case GL_DEBUG_SEVERITY_MEDIUM: LOG("Severity:Medium Type:0x%x Message:%s\n", Type, Msg); break;
-    case GL_DEBUG_SEVERITY_HIGH: LOG("Severity:High Type:0x%x Message:%s\n", Type, Msg); break;
+    case GL_DEBUG_SEVERITY_LOW: LOG_INFO("Severity:Low Type:0x%x Message:%s\n", Type, Msg); break;
+    case GL_DEBUG_SEVERITY_MEDIUM: LOG_WARNING("Severity:Medium Type:0x%x Message:%s\n", Type, Msg); break;
+    case GL_DEBUG_SEVERITY_HIGH: LOG_ERROR("Severity:High Type:0x%x Message:%s\n", Type, Msg); break;
   }
 }
 
@@ -168,14 +190,35 @@ static void GlDebugCallback(ark::U32 Source, ark::U32 Type, ark::U32 Id, ark::U3
 
 ark::I32 main()
 {
+  ark::JobSystem::Initialize();
+
   gConfig.Parse(ark::FileUtils::ReadText("Config.json").c_str());
   gPacker.Parse(ark::FileUtils::ReadText("Packer.json").c_str());
   gWorld.Parse(ark::FileUtils::ReadText("World.json").c_str());
 
+  ark::Logger::SetHistorySize(ark::LogConsole::sHistorySize);
+
+  if (gConfig.HasMember("logFile") && gConfig["logFile"].IsString())
+  {
+    ark::Logger::SetFile(gConfig["logFile"].GetString());
+  }
+
+  // Unpacked files win over archive entries, levels without an unpack are read straight from the game
+
+  if (gConfig.HasMember("archiveCacheSize") && gConfig["archiveCacheSize"].IsUint())
+  {
+    gFileSystem.SetCacheSize(gConfig["archiveCacheSize"].GetUint() * 1024ULL * 1024ULL);
+  }
+
+  gFileSystem.MountDirectory(gConfig["unpackDir"].GetString());
+  gFileSystem.MountArchives(std::filesystem::path{ gConfig["gameDir"].GetString() } / "data_pc", gPacker["encryptionKey"].GetString(), gPacker["sources"]);
+
   gInterfaces.emplace_back(new ark::AssetBrowser);
   gInterfaces.emplace_back(new ark::MainMenu);
   gInterfaces.emplace_back(new ark::FileInspector);
   gInterfaces.emplace_back(new ark::SceneOutline);
+  gInterfaces.emplace_back(new ark::FrameProfiler);
+  gInterfaces.emplace_back(new ark::LogConsole);
 
   glfwSetErrorCallback(GlfwDebugProc);
 
@@ -193,6 +236,9 @@ ark::I32 main()
     {
       glfwSetWindowSizeCallback(sGlfwContext, GlfwResizeProc);
       glfwSetCursorPosCallback(sGlfwContext, GlfwMouseProc);
+      glfwSetKeyCallback(sGlfwContext, GlfwKeyProc);
+      glfwSetMouseButtonCallback(sGlfwContext, GlfwButtonProc);
+      glfwSetScrollCallback(sGlfwContext, GlfwScrollProc);
       glfwMakeContextCurrent(sGlfwContext);
       glfwSwapInterval(0);
 
@@ -201,7 +247,9 @@ ark::I32 main()
         glEnable(GL_DEBUG_OUTPUT);
         glDebugMessageCallback(GlDebugCallback, 0);
 
-        gDebugRenderer = new ark::DebugRenderer{ 65535, 65535 * 2 };
+        glEnable(GL_PRIMITIVE_RESTART_FIXED_INDEX);
+
+        gDebugRenderer = new ark::DebugRenderer{ 65535 };
         gDefaultRenderer = new ark::DefaultRenderer;
 
         IMGUI_CHECKVERSION();
@@ -231,6 +279,10 @@ ark::I32 main()
           sTimeDelta = sTime - sTimePrev;
           sTimePrev = sTime;
 
+          ark::Profiler::BeginFrame();
+
+          ark::JobSystem::RunMainThreadJobs();
+
           glClearColor(0.0F, 0.0F, 0.0F, 1.0F);
           glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
           glViewport(0, 0, (ark::I32)ark::Window::GetWidth(), (ark::I32)ark::Window::GetHeight());
@@ -244,30 +296,54 @@ ark::I32 main()
 
           if (gScene)
           {
+            ark::ProfilerCpuScope scope{ "Scene Update" };
+
             gScene->Update(sTimeDelta);
           }
 
           gDefaultRenderer->Render();
           gDebugRenderer->Render();
 
-          for (auto& interface : gInterfaces)
           {
-            interface->Draw();
+            ark::ProfilerCpuScope scope{ "Interfaces" };
+
+            for (auto& interface : gInterfaces)
+            {
+              interface->Draw();
+            }
           }
 
-          ImGui::Render();
+          {
+            ark::ProfilerCpuScope scope{ "ImGui Render" };
+
+            ImGui::Render();
 
-          ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+            {
+              ark::ProfilerGpuScope gpuScope{ "ImGui Render" };
 
-          ImGui::UpdatePlatformWindows();
-          ImGui::RenderPlatformWindowsDefault();
+              ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+            }
+
+            // Platform windows render into their own contexts, timer queries do not carry over
+
+            ImGui::UpdatePlatformWindows();
+            ImGui::RenderPlatformWindowsDefault();
+          }
 
           glfwMakeContextCurrent(sGlfwContext);
-          glfwSwapBuffers(sGlfwContext);
+
+          {
+            ark::ProfilerCpuScope scope{ "Swap Buffers" };
+
+            glfwSwapBuffers(sGlfwContext);
+          }
 
           ark::Event::Poll(sGlfwContext);
+          ark::Profiler::EndFrame();
         }
 
+        ark::Profiler::Destroy();
+
         ImGui_ImplOpenGL3_Shutdown();
         ImGui_ImplGlfw_Shutdown();
 
@@ -281,7 +357,7 @@ ark::I32 main()
       }
       else
       {
-        LOG("Failed initializing GL\n");
+        LOG_ERROR("Failed initializing GL\n");
       }
 
       glfwDestroyWindow(sGlfwContext);
@@ -289,12 +365,12 @@ ark::I32 main()
     }
     else
     {
-      LOG("Failed creating window\n");
+      LOG_ERROR("Failed creating window\n");
     }
   }
   else
   {
-    LOG("Failed initializing GLFW\n");
+    LOG_ERROR("Failed initializing GLFW\n");
   }
 
   for (auto& interface : gInterfaces)
@@ -303,5 +379,7 @@ ark::I32 main()
     interface = nullptr;
   }
 
+  ark::JobSystem::Shutdown();
+
   return 0;
 }
\ No newline at end of file
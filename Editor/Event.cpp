@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <iterator>
+
 #include <Editor/Event.h>
 
 #include <Vendor/GLFW/glfw3.h>
@@ -12,66 +15,69 @@ namespace ark
   {
     glfwPollEvents();
 
-    for (U32 i = GLFW_KEY_SPACE; i < GLFW_KEY_LAST; i++)
+    // Keys which went down or up last frame are held or released by now
+
+    for (EventRecord* record : sTransitions)
     {
-      I32 action = glfwGetKey(Context, i);
+      record->Prev = record->Curr;
 
-      sKeyboardKeys[i].Prev = sKeyboardKeys[i].Curr;
+      if (record->Curr == eEventStateDown) record->Curr = eEventStateHeld;
+      if (record->Curr == eEventStateUp) record->Curr = eEventStateNone;
+    }
 
-      if (action == GLFW_PRESS)
-      {
-        if (sKeyboardKeys[i].Curr != eEventStateDown && sKeyboardKeys[i].Prev != eEventStateHeld)
-        {
-          sKeyboardKeys[i].Curr = eEventStateDown;
-        }
-        else
-        {
-          sKeyboardKeys[i].Curr = eEventStateHeld;
-        }
-      }
+    sTransitions.clear();
 
-      if (action == GLFW_RELEASE)
+    for (const auto& event : sEvents)
+    {
+      EventRecord* record = FindRecord(event);
+
+      if (!record)
       {
-        if (sKeyboardKeys[i].Curr != eEventStateUp && sKeyboardKeys[i].Prev == eEventStateHeld)
-        {
-          sKeyboardKeys[i].Curr = eEventStateUp;
-        }
-        else
-        {
-          sKeyboardKeys[i].Curr = eEventStateNone;
-        }
+        continue;
       }
-    }
 
-    for (U32 i = 0; i < GLFW_MOUSE_BUTTON_LAST; i++)
-    {
-      I32 action = glfwGetMouseButton(Context, i);
+      if (std::find(sTransitions.begin(), sTransitions.end(), record) != sTransitions.end())
+      {
+        sDeferredEvents.emplace_back(event);
 
-      sMouseKeys[i].Prev = sMouseKeys[i].Curr;
+        continue;
+      }
 
-      if (action == GLFW_PRESS)
+      if (event.Action == GLFW_PRESS && (record->Curr == eEventStateNone || record->Curr == eEventStateUp))
       {
-        if (sMouseKeys[i].Curr != eEventStateDown && sMouseKeys[i].Prev != eEventStateHeld)
-        {
-          sMouseKeys[i].Curr = eEventStateDown;
-        }
-        else
-        {
-          sMouseKeys[i].Curr = eEventStateHeld;
-        }
+        record->Prev = record->Curr;
+        record->Curr = eEventStateDown;
+
+        sTransitions.emplace_back(record);
       }
 
-      if (action == GLFW_RELEASE)
+      if (event.Action == GLFW_RELEASE && (record->Curr == eEventStateDown || record->Curr == eEventStateHeld))
       {
-        if (sMouseKeys[i].Curr != eEventStateUp && sMouseKeys[i].Prev == eEventStateHeld)
-        {
-          sMouseKeys[i].Curr = eEventStateUp;
-        }
-        else
-        {
-          sMouseKeys[i].Curr = eEventStateNone;
-        }
+        record->Prev = record->Curr;
+        record->Curr = eEventStateUp;
+
+        sTransitions.emplace_back(record);
       }
     }
+
+    sEvents.swap(sDeferredEvents);
+    sDeferredEvents.clear();
+
+    sScrollX = sPendingScrollX;
+    sScrollY = sPendingScrollY;
+
+    sPendingScrollX = 0.0F;
+    sPendingScrollY = 0.0F;
+  }
+
+  Event::EventRecord* Event::FindRecord(const InputEvent& Event)
+  {
+    switch (Event.Type)
+    {
+      case eInputTypeKeyboard: return (Event.Code >= 0 && Event.Code < (I32)std::size(sKeyboardKeys)) ? &sKeyboardKeys[Event.Code] : nullptr;
+      case eInputTypeMouse: return (Event.Code >= 0 && Event.Code < (I32)std::size(sMouseKeys)) ? &sMouseKeys[Event.Code] : nullptr;
+    }
+
+    return nullptr;
   }
 }
\ No newline at end of file
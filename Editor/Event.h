@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include <Common/Types.h>
 
 #include <Editor/Forward.h>
@@ -10,6 +12,14 @@
 
 namespace ark
 {
+  /*
+   * Input state fed by the window callbacks.
+   *
+   * Callbacks only queue what happened, polling applies the queue once per frame and
+   * settles the keys which changed during the previous one, so untouched keys cost
+   * nothing. A key never changes twice within one frame, a release arriving in the
+   * same frame as its press is kept for the next one and reported as up then.
+   */
   class Event
   {
   public:
@@ -75,16 +85,35 @@ namespace ark
       eEventStateUp,
     };
 
+    enum InputType
+    {
+      eInputTypeKeyboard,
+      eInputTypeMouse,
+    };
+
     struct EventRecord
     {
       EventState Curr;
       EventState Prev;
     };
 
+    struct InputEvent
+    {
+      InputType Type;
+      I32 Code;
+      I32 Action;
+    };
+
   public:
 
     static void Poll(GLFWwindow* Context);
 
+  public:
+
+    static inline void QueueKey(I32 Key, I32 Action) { sEvents.emplace_back(InputEvent{ eInputTypeKeyboard, Key, Action }); }
+    static inline void QueueMouse(I32 Button, I32 Action) { sEvents.emplace_back(InputEvent{ eInputTypeMouse, Button, Action }); }
+    static inline void QueueScroll(R32 X, R32 Y) { sPendingScrollX += X; sPendingScrollY += Y; }
+
   public:
 
     static inline U32 KeyDown(U32 Key) { return sKeyboardKeys[Key].Curr == eEventStateDown; }
@@ -103,6 +132,9 @@ namespace ark
     static inline R32 GetMouseY() { return sMouseY; }
     static inline R32V2 GetMousePosition() { return { sMouseX, sMouseY }; }
 
+    static inline R32 GetScrollX() { return sScrollX; }
+    static inline R32 GetScrollY() { return sScrollY; }
+
   public:
 
     static inline void SetMouseX(R32 X) { sMouseX = X; }
@@ -110,10 +142,23 @@ namespace ark
 
   private:
 
-    static inline EventRecord sKeyboardKeys[348] = {};
-    static inline EventRecord sMouseKeys[7] = {};
+    static EventRecord* FindRecord(const InputEvent& Event);
+
+  private:
+
+    static inline EventRecord sKeyboardKeys[349] = {};
+    static inline EventRecord sMouseKeys[8] = {};
+
+    static inline std::vector<InputEvent> sEvents = {};
+    static inline std::vector<InputEvent> sDeferredEvents = {};
+    static inline std::vector<EventRecord*> sTransitions = {};
 
     static inline R32 sMouseX = 0.0F;
     static inline R32 sMouseY = 0.0F;
+
+    static inline R32 sScrollX = 0.0F;
+    static inline R32 sScrollY = 0.0F;
+    static inline R32 sPendingScrollX = 0.0F;
+    static inline R32 sPendingScrollY = 0.0F;
   };
 }
\ No newline at end of file
@@ -11,6 +11,9 @@ namespace ark
   class Player;
 
   class Model;
+  class ModelGroup;
+  class ModelEntry;
+  class ModelDivision;
   class Object;
 
   class Camera;
@@ -23,6 +26,8 @@ namespace ark
   class ModelSerializer;
   class ObjectSerializer;
 
+  class MeshOptimizer;
+
   class AssetBrowser;
   class FileInspector;
   class MainMenu;
@@ -31,6 +36,7 @@ namespace ark
   class Actor;
   class Component;
   class Event;
+  class Hierarchy;
   class Interface;
 
   template<typename V, typename E>
@@ -39,6 +45,9 @@ namespace ark
   class Packer;
   class Scene;
   class Shader;
+  class Texture;
+  class TextureArray;
+  class TextureCache;
 
   struct DefaultVertex;
   struct DebugVertex;
@@ -0,0 +1,264 @@
+#include <algorithm>
+#include <numeric>
+
+#include <Editor/Hierarchy.h>
+
+#include <Vendor/GLM/gtc/matrix_transform.hpp>
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  template<typename T>
+  static void Permute(std::vector<T>& Values, const std::vector<U32>& Order)
+  {
+    std::vector<T> values = {};
+
+    values.reserve(Order.size());
+
+    for (U32 index : Order)
+    {
+      values.emplace_back(Values[index]);
+    }
+
+    Values = std::move(values);
+  }
+}
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  U32 Hierarchy::Allocate()
+  {
+    U32 handle = 0;
+
+    if (mFreeHandles.empty())
+    {
+      handle = (U32)mSparse.size();
+
+      mSparse.emplace_back(sInvalidHandle);
+    }
+    else
+    {
+      handle = mFreeHandles.back();
+
+      mFreeHandles.pop_back();
+    }
+
+    U32 index = (U32)mHandles.size();
+
+    mSparse[handle] = index;
+
+    mHandles.emplace_back(handle);
+    mParents.emplace_back(sInvalidHandle);
+    mDirty.emplace_back(eDirtyLocal | eDirtyWorld);
+
+    mLocalPositions.emplace_back(0.0F, 0.0F, 0.0F);
+    mLocalRotations.emplace_back(0.0F, 0.0F, 0.0F);
+    mLocalScales.emplace_back(1.0F, 1.0F, 1.0F);
+
+    mLocalMatrices.emplace_back(glm::identity<R32M4>());
+    mWorldMatrices.emplace_back(glm::identity<R32M4>());
+
+    mDirtyBegin = std::min(mDirtyBegin, index);
+
+    return handle;
+  }
+
+  void Hierarchy::Free(U32 Handle)
+  {
+    U32 index = mSparse[Handle];
+
+    mHandles[index] = sInvalidHandle;
+    mSparse[Handle] = sInvalidHandle;
+
+    mFreeHandles.emplace_back(Handle);
+
+    mRequiresCompaction = 1;
+  }
+
+  U32 Hierarchy::GetParent(U32 Handle) const
+  {
+    U32 parent = mParents[mSparse[Handle]];
+
+    return (parent == sInvalidHandle) ? sInvalidHandle : mHandles[parent];
+  }
+
+  const R32M4& Hierarchy::GetLocalMatrix(U32 Handle)
+  {
+    Update();
+
+    return mLocalMatrices[mSparse[Handle]];
+  }
+
+  const R32M4& Hierarchy::GetWorldMatrix(U32 Handle)
+  {
+    Update();
+
+    return mWorldMatrices[mSparse[Handle]];
+  }
+
+  void Hierarchy::SetParent(U32 Handle, U32 Parent)
+  {
+    U32 index = mSparse[Handle];
+    U32 parentIndex = (Parent == sInvalidHandle) ? sInvalidHandle : mSparse[Parent];
+
+    mParents[index] = parentIndex;
+
+    if (parentIndex != sInvalidHandle && parentIndex > index)
+    {
+      mRequiresSort = 1;
+    }
+
+    MarkDirty(index);
+  }
+
+  void Hierarchy::SetLocalPosition(U32 Handle, const R32V3& Position)
+  {
+    U32 index = mSparse[Handle];
+
+    mLocalPositions[index] = Position;
+
+    MarkDirty(index);
+  }
+
+  void Hierarchy::SetLocalRotation(U32 Handle, const R32V3& Rotation)
+  {
+    U32 index = mSparse[Handle];
+
+    mLocalRotations[index] = Rotation;
+
+    MarkDirty(index);
+  }
+
+  void Hierarchy::SetLocalScale(U32 Handle, const R32V3& Scale)
+  {
+    U32 index = mSparse[Handle];
+
+    mLocalScales[index] = Scale;
+
+    MarkDirty(index);
+  }
+
+  void Hierarchy::Update()
+  {
+    if (mRequiresCompaction || mRequiresSort)
+    {
+      Rebuild();
+    }
+
+    if (mDirtyBegin == sInvalidHandle)
+    {
+      return;
+    }
+
+    U32 count = (U32)mHandles.size();
+
+    for (U32 i = mDirtyBegin; i < count; i++)
+    {
+      U32 parent = mParents[i];
+
+      if (parent != sInvalidHandle && (mDirty[parent] & eDirtyWorld))
+      {
+        mDirty[i] |= eDirtyWorld;
+      }
+
+      if (mDirty[i] & eDirtyLocal)
+      {
+        R32M4 local = glm::identity<R32M4>();
+
+        local = glm::translate(local, mLocalPositions[i]);
+        local = glm::rotate(local, mLocalRotations[i].x, R32V3{ 1.0F, 0.0F, 0.0F });
+        local = glm::rotate(local, mLocalRotations[i].y, R32V3{ 0.0F, 1.0F, 0.0F });
+        local = glm::rotate(local, mLocalRotations[i].z, R32V3{ 0.0F, 0.0F, 1.0F });
+        local = glm::scale(local, mLocalScales[i]);
+
+        mLocalMatrices[i] = local;
+      }
+
+      if (mDirty[i] & eDirtyWorld)
+      {
+        mWorldMatrices[i] = (parent == sInvalidHandle) ? mLocalMatrices[i] : mWorldMatrices[parent] * mLocalMatrices[i];
+      }
+    }
+
+    std::fill(mDirty.begin() + mDirtyBegin, mDirty.end(), (U8)eDirtyNone);
+
+    mDirtyBegin = sInvalidHandle;
+  }
+
+  void Hierarchy::MarkDirty(U32 Index)
+  {
+    mDirty[Index] |= eDirtyLocal | eDirtyWorld;
+
+    mDirtyBegin = std::min(mDirtyBegin, Index);
+  }
+
+  void Hierarchy::Rebuild()
+  {
+    U32 count = (U32)mHandles.size();
+
+    std::vector<U32> order = {};
+
+    order.reserve(count);
+
+    for (U32 i = 0; i < count; i++)
+    {
+      if (mHandles[i] != sInvalidHandle)
+      {
+        order.emplace_back(i);
+      }
+    }
+
+    if (mRequiresSort)
+    {
+      std::vector<U32> depths = std::vector<U32>(count, 0);
+
+      for (U32 index : order)
+      {
+        for (U32 parent = mParents[index]; parent != sInvalidHandle && mHandles[parent] != sInvalidHandle; parent = mParents[parent])
+        {
+          depths[index]++;
+        }
+      }
+
+      std::stable_sort(order.begin(), order.end(), [&](U32 A, U32 B) { return depths[A] < depths[B]; });
+    }
+
+    std::vector<U32> remap = std::vector<U32>(count, sInvalidHandle);
+
+    for (U32 i = 0; i < order.size(); i++)
+    {
+      remap[order[i]] = i;
+    }
+
+    Permute(mHandles, order);
+    Permute(mParents, order);
+    Permute(mLocalPositions, order);
+    Permute(mLocalRotations, order);
+    Permute(mLocalScales, order);
+    Permute(mLocalMatrices, order);
+    Permute(mWorldMatrices, order);
+
+    mDirty.assign(order.size(), eDirtyLocal | eDirtyWorld);
+
+    for (U32 i = 0; i < order.size(); i++)
+    {
+      if (mParents[i] != sInvalidHandle)
+      {
+        mParents[i] = remap[mParents[i]];
+      }
+
+      mSparse[mHandles[i]] = i;
+    }
+
+    mDirtyBegin = order.empty() ? sInvalidHandle : 0;
+    mRequiresCompaction = 0;
+    mRequiresSort = 0;
+  }
+}
\ No newline at end of file
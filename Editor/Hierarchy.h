@@ -0,0 +1,93 @@
+#pragma once
+
+#include <vector>
+
+#include <Common/Types.h>
+
+///////////////////////////////////////////////////////////
+// Definition
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  /*
+   * Transform storage of a scene.
+   *
+   * All local and world state lives in parallel arrays which are kept in an
+   * order where every parent precedes its children. World matrices are only
+   * recomputed for the range touched since the last update, in one linear pass.
+   * Handles stay stable while the dense arrays get compacted or re-ordered.
+   */
+  class Hierarchy
+  {
+  public:
+
+    static constexpr U32 sInvalidHandle = 0xFFFFFFFF;
+
+  private:
+
+    enum DirtyFlags
+    {
+      eDirtyNone = 0,
+      eDirtyLocal = 1,
+      eDirtyWorld = 2,
+    };
+
+  public:
+
+    U32 Allocate();
+    void Free(U32 Handle);
+
+  public:
+
+    inline auto GetCount() const { return (U32)mHandles.size(); }
+
+    U32 GetParent(U32 Handle) const;
+
+  public:
+
+    inline const auto& GetLocalPosition(U32 Handle) const { return mLocalPositions[mSparse[Handle]]; }
+    inline const auto& GetLocalRotation(U32 Handle) const { return mLocalRotations[mSparse[Handle]]; }
+    inline const auto& GetLocalScale(U32 Handle) const { return mLocalScales[mSparse[Handle]]; }
+
+    const R32M4& GetLocalMatrix(U32 Handle);
+    const R32M4& GetWorldMatrix(U32 Handle);
+
+  public:
+
+    void SetParent(U32 Handle, U32 Parent);
+
+    void SetLocalPosition(U32 Handle, const R32V3& Position);
+    void SetLocalRotation(U32 Handle, const R32V3& Rotation);
+    void SetLocalScale(U32 Handle, const R32V3& Scale);
+
+  public:
+
+    void Update();
+
+  private:
+
+    void MarkDirty(U32 Index);
+    void Rebuild();
+
+  private:
+
+    std::vector<U32> mSparse = {};
+    std::vector<U32> mFreeHandles = {};
+
+    std::vector<U32> mHandles = {};
+    std::vector<U32> mParents = {};
+    std::vector<U8> mDirty = {};
+
+    std::vector<R32V3> mLocalPositions = {};
+    std::vector<R32V3> mLocalRotations = {};
+    std::vector<R32V3> mLocalScales = {};
+
+    std::vector<R32M4> mLocalMatrices = {};
+    std::vector<R32M4> mWorldMatrices = {};
+
+    U32 mDirtyBegin = sInvalidHandle;
+    U32 mRequiresCompaction = 0;
+    U32 mRequiresSort = 0;
+  };
+}
\ No newline at end of file
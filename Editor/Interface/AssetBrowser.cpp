@@ -18,13 +18,56 @@ namespace ark
 {
   void AssetBrowser::Update()
   {
+    mModelRows.clear();
 
+    mScene = gScene;
+    mRevision = gScene ? gScene->GetRevision() : 0;
+
+    if (!gScene)
+    {
+      return;
+    }
+
+    for (const auto& modelGroup : gScene->GetModelGroups())
+    {
+      for (const auto& modelEntry : modelGroup)
+      {
+        U32 vertexCount = 0;
+        U32 elementCount = 0;
+
+        for (const auto& modelDivision : modelEntry)
+        {
+          vertexCount += (U32)modelDivision.GetVertexCount();
+          elementCount += (U32)modelDivision.GetElementCount();
+        }
+
+        mModelRows.emplace_back(ModelRow{ modelGroup.GetName() + " " + std::to_string(modelEntry.GetId()), vertexCount, elementCount, modelEntry.GetPosition(), modelEntry.GetRotation(), modelEntry.GetScale() });
+      }
+    }
   }
 
   void AssetBrowser::Draw()
   {
+    if (mScene != gScene || (gScene && mRevision != gScene->GetRevision()))
+    {
+      Update();
+    }
+
     ImGui::Begin("Object Browser");
 
+    DrawObjectTable();
+
+    ImGui::End();
+
+    ImGui::Begin("Model Browser");
+
+    DrawModelTable();
+
+    ImGui::End();
+  }
+
+  void AssetBrowser::DrawObjectTable()
+  {
     if (ImGui::BeginTable("Object Table", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY | ImGuiTableFlags_BordersInnerV))
     {
       ImGui::TableSetupColumn("Id", ImGuiTableColumnFlags_WidthFixed, 100.0F);
@@ -35,38 +78,47 @@ namespace ark
 
       if (gScene)
       {
-        for (const auto& object : gScene->GetObjects())
-        {
-          ImGui::TableNextRow();
-          ImGui::TableNextColumn();
+        const auto& objects = gScene->GetObjects();
 
-          ImGui::Text("%u", object.GetId());
-          ImGui::TableNextColumn();
+        ImGuiListClipper clipper = {};
 
-          ImGui::Text("%u", object.GetCategory());
-          ImGui::TableNextColumn();
+        clipper.Begin((I32)objects.size());
 
-          ImGui::Text("[%6.3f,%6.3f,%6.3f] [%6.3f,%6.3f,%6.3f] [%6.3f,%6.3f,%6.3f]",
-            object.GetPosition().x,
-            object.GetPosition().y,
-            object.GetPosition().z,
-            object.GetRotation().x,
-            object.GetRotation().y,
-            object.GetRotation().z,
-            object.GetScale().x,
-            object.GetScale().y,
-            object.GetScale().z);
-          ImGui::TableNextColumn();
+        while (clipper.Step())
+        {
+          for (I32 i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+          {
+            const Object& object = objects[i];
+
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+
+            ImGui::Text("%u", object.GetId());
+            ImGui::TableNextColumn();
+
+            ImGui::Text("%u", object.GetCategory());
+            ImGui::TableNextColumn();
+
+            ImGui::Text("[%6.3f,%6.3f,%6.3f] [%6.3f,%6.3f,%6.3f] [%6.3f,%6.3f,%6.3f]",
+              object.GetPosition().x,
+              object.GetPosition().y,
+              object.GetPosition().z,
+              object.GetRotation().x,
+              object.GetRotation().y,
+              object.GetRotation().z,
+              object.GetScale().x,
+              object.GetScale().y,
+              object.GetScale().z);
+          }
         }
       }
 
       ImGui::EndTable();
     }
+  }
 
-    ImGui::End();
-
-    ImGui::Begin("Model Browser");
-
+  void AssetBrowser::DrawModelTable()
+  {
     if (ImGui::BeginTable("Model Table", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY | ImGuiTableFlags_BordersInnerV))
     {
       ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthFixed, 150.0F);
@@ -76,39 +128,42 @@ namespace ark
       ImGui::TableSetupScrollFreeze(0, 1);
       ImGui::TableHeadersRow();
 
-      if (gScene)
+      ImGuiListClipper clipper = {};
+
+      clipper.Begin((I32)mModelRows.size());
+
+      while (clipper.Step())
       {
-        for (const auto& modelGroup : gScene->GetModelGroups())
+        for (I32 i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
         {
-          //ImGui::TableNextRow();
-          //ImGui::TableNextColumn();
-          //
-          //ImGui::Text("%s", model.GetName().c_str());
-          //ImGui::TableNextColumn();
-          //
-          //ImGui::Text("%u", (U32)model.GetVertexBuffer().size());
-          //ImGui::TableNextColumn();
-          //
-          //ImGui::Text("%u", (U32)model.GetElementBuffer().size());
-          //ImGui::TableNextColumn();
-          //
-          //ImGui::Text("[%6.3f,%6.3f,%6.3f] [%6.3f,%6.3f,%6.3f] [%6.3f,%6.3f,%6.3f]",
-          //  model.GetTransform().Position.x,
-          //  model.GetTransform().Position.y,
-          //  model.GetTransform().Position.z,
-          //  model.GetTransform().Rotation.x,
-          //  model.GetTransform().Rotation.y,
-          //  model.GetTransform().Rotation.z,
-          //  model.GetTransform().Scale.x,
-          //  model.GetTransform().Scale.y,
-          //  model.GetTransform().Scale.z);
-          //ImGui::TableNextColumn();
+          const ModelRow& row = mModelRows[i];
+
+          ImGui::TableNextRow();
+          ImGui::TableNextColumn();
+
+          ImGui::TextUnformatted(row.Name.c_str());
+          ImGui::TableNextColumn();
+
+          ImGui::Text("%u", row.VertexCount);
+          ImGui::TableNextColumn();
+
+          ImGui::Text("%u", row.ElementCount);
+          ImGui::TableNextColumn();
+
+          ImGui::Text("[%6.3f,%6.3f,%6.3f] [%6.3f,%6.3f,%6.3f] [%6.3f,%6.3f,%6.3f]",
+            row.Position.x,
+            row.Position.y,
+            row.Position.z,
+            row.Rotation.x,
+            row.Rotation.y,
+            row.Rotation.z,
+            row.Scale.x,
+            row.Scale.y,
+            row.Scale.z);
         }
       }
 
       ImGui::EndTable();
     }
-
-    ImGui::End();
   }
 }
\ No newline at end of file
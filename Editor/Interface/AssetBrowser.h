@@ -1,5 +1,11 @@
 #pragma once
 
+#include <string>
+#include <vector>
+
+#include <Common/Types.h>
+
+#include <Editor/Forward.h>
 #include <Editor/Interface.h>
 
 ///////////////////////////////////////////////////////////
@@ -8,11 +14,39 @@
 
 namespace ark
 {
+  /*
+   * Tables only submit the rows in view. Objects are listed straight from the scene,
+   * models are flattened into one row per entry whenever the scene revision moved.
+   */
   class AssetBrowser : public Interface
   {
+  private:
+
+    struct ModelRow
+    {
+      std::string Name;
+      U32 VertexCount;
+      U32 ElementCount;
+      R32V3 Position;
+      R32V3 Rotation;
+      R32V3 Scale;
+    };
+
   public:
 
     virtual void Update() override;
     virtual void Draw() override;
+
+  private:
+
+    void DrawObjectTable();
+    void DrawModelTable();
+
+  private:
+
+    std::vector<ModelRow> mModelRows = {};
+
+    Scene* mScene = nullptr;
+    U64 mRevision = 0;
   };
 }
\ No newline at end of file
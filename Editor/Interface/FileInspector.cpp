@@ -18,13 +18,45 @@ namespace ark
 {
   void FileInspector::Update()
   {
-    delete mFileNode;
-    mFileNode = new FileNode{ gConfig["unpackDir"].GetString() };
-    mSelectedNode = nullptr;
+    // The tree is built once in the background, later updates only re-list what was expanded
+
+    if (mFileNode)
+    {
+      mFileNode->Refresh();
+    }
+    else
+    {
+      mFileWatcher = new FileWatcher{ gConfig["unpackDir"].GetString() };
+      mFileNode = new FileNode{ gConfig["unpackDir"].GetString(), mFileWatcher };
+    }
   }
 
   void FileInspector::Draw()
   {
+    // Changes on disk are applied as they happen, the manual update only remains for
+    // trees which could not be watched
+
+    if (mFileWatcher)
+    {
+      for (const auto& event : mFileWatcher->Poll())
+      {
+        mFileNode->Apply(event);
+      }
+    }
+
+    if (mRequiresRebuild || mRevision != FileNode::GetRevision())
+    {
+      mRows.clear();
+
+      if (mFileNode)
+      {
+        AddFileRowsRecursive(mFileNode, 0);
+      }
+
+      mRevision = FileNode::GetRevision();
+      mRequiresRebuild = 0;
+    }
+
     ImGui::Begin("File Inspector");
 
     if (ImGui::Button("Update"))
@@ -32,38 +64,89 @@ namespace ark
       Update();
     }
 
-    DrawFileNodeRecursive(mFileNode);
+    ImGuiListClipper clipper = {};
+
+    clipper.Begin((I32)mRows.size());
+
+    while (clipper.Step())
+    {
+      for (I32 i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+      {
+        DrawRow(mRows[i]);
+      }
+    }
 
     ImGui::End();
   }
 
-  void FileInspector::DrawFileNodeRecursive(FileNode* Node)
+  void FileInspector::AddFileRowsRecursive(FileNode* Node, U32 Depth)
   {
-    std::uint32_t flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_SpanFullWidth;
-
-    if (Node == mSelectedNode) flags |= ImGuiTreeNodeFlags_Selected;
+    mRows.emplace_back(FileRow{ Node, Depth, eFileRowNode });
 
-    if (Node->IsFile())
+    if (mOpenFiles.contains(Node->GetPath()))
     {
-      flags |= ImGuiTreeNodeFlags_Leaf;
+      if (Node->IsScanning() && Node->begin() == Node->end())
+      {
+        mRows.emplace_back(FileRow{ Node, Depth + 1, eFileRowScanning });
+      }
+
+      for (auto& [file, node] : *Node)
+      {
+        AddFileRowsRecursive(node, Depth + 1);
+      }
     }
+  }
 
-    std::string name = Node->GetName().string() + Node->GetExtension().string();
-    std::uint32_t opened = ImGui::TreeNodeEx(name.c_str(), flags);
+  void FileInspector::DrawRow(const FileRow& Row)
+  {
+    FileNode* node = Row.Node;
 
-    if (ImGui::IsItemClicked(0) || ImGui::IsItemClicked(1))
+    R32 indent = ImGui::GetStyle().IndentSpacing * Row.Depth;
+
+    if (indent > 0.0F) ImGui::Indent(indent);
+
+    if (Row.Type == eFileRowScanning)
     {
-      mSelectedNode = Node;
+      ImGui::TextDisabled("Scanning...");
     }
-
-    if (opened)
+    else
     {
-      for (auto& [file, node] : *Node)
+      std::uint32_t flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_SpanFullWidth | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+
+      if (node->GetPath() == mSelectedFile) flags |= ImGuiTreeNodeFlags_Selected;
+
+      if (node->IsFile())
       {
-        DrawFileNodeRecursive(node);
+        flags |= ImGuiTreeNodeFlags_Leaf;
       }
 
-      ImGui::TreePop();
+      // Open state is owned by the inspector so the flattened rows can follow it
+
+      U32 open = mOpenFiles.contains(node->GetPath());
+
+      ImGui::SetNextItemOpen(open);
+
+      std::string name = node->GetName().string() + node->GetExtension().string();
+      U32 opened = ImGui::TreeNodeEx((void*)node, flags, "%s", name.c_str());
+
+      if (ImGui::IsItemClicked(0) || ImGui::IsItemClicked(1))
+      {
+        mSelectedFile = node->GetPath();
+      }
+
+      if (opened != open)
+      {
+        if (opened) mOpenFiles.emplace(node->GetPath()); else mOpenFiles.erase(node->GetPath());
+
+        if (opened)
+        {
+          node->Expand();
+        }
+
+        mRequiresRebuild = 1;
+      }
     }
+
+    if (indent > 0.0F) ImGui::Unindent(indent);
   }
 }
\ No newline at end of file
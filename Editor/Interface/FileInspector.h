@@ -1,6 +1,10 @@
 #pragma once
 
 #include <filesystem>
+#include <set>
+#include <vector>
+
+#include <Common/FileWatcher.h>
 
 #include <Common/Trees/FileNode.h>
 
@@ -12,6 +16,7 @@
 // Namespaces
 ///////////////////////////////////////////////////////////
 
+namespace fs = std::filesystem;
 namespace rj = rapidjson;
 
 ///////////////////////////////////////////////////////////
@@ -20,8 +25,27 @@ namespace rj = rapidjson;
 
 namespace ark
 {
+  /*
+   * The expanded part of the file tree is flattened into rows, which are rebuilt once the
+   * tree changed or a node was toggled. Only the rows in view are submitted.
+   */
   class FileInspector : public Interface
   {
+  private:
+
+    enum FileRowType
+    {
+      eFileRowNode = 0,
+      eFileRowScanning = 1,
+    };
+
+    struct FileRow
+    {
+      FileNode* Node;
+      U32 Depth;
+      FileRowType Type;
+    };
+
   public:
 
     virtual void Update() override;
@@ -29,11 +53,20 @@ namespace ark
 
   private:
 
-    void DrawFileNodeRecursive(FileNode* Node);
+    void AddFileRowsRecursive(FileNode* Node, U32 Depth);
+
+    void DrawRow(const FileRow& Row);
 
   private:
 
     FileNode* mFileNode = nullptr;
-    FileNode* mSelectedNode = nullptr;
+    FileWatcher* mFileWatcher = nullptr;
+
+    std::vector<FileRow> mRows = {};
+    std::set<fs::path> mOpenFiles = {};
+
+    U64 mRevision = 0;
+    U32 mRequiresRebuild = 1;
+    fs::path mSelectedFile = {};
   };
 }
\ No newline at end of file
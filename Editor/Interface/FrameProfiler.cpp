@@ -0,0 +1,72 @@
+#include <Editor/Profiler.h>
+
+#include <Editor/Interface/FrameProfiler.h>
+
+#include <Vendor/ImGui/imgui.h>
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  void FrameProfiler::Update()
+  {
+
+  }
+
+  void FrameProfiler::Draw()
+  {
+    ImGui::Begin("Frame Profiler");
+
+    const ProfilerFrame& frame = Profiler::GetResolvedFrame();
+
+    ImGui::Text("Frame      : %.3f ms", frame.CpuTime);
+    ImGui::Text("Draw Calls : %u", frame.DrawCalls);
+    ImGui::Text("Uploads    : %.2f KB", (R64)frame.UploadBytes / 1024.0);
+
+    ImGui::PlotLines("##FrameTimes", Profiler::GetFrameTimes(), (I32)Profiler::sHistorySize, (I32)Profiler::GetFrameTimeOffset(), "Frame Time", 0.0F, 33.3F, ImVec2{ ImGui::GetContentRegionAvail().x, 60.0F });
+
+    if (ImGui::BeginTable("CPU", 2, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV))
+    {
+      ImGui::TableSetupColumn("CPU Scope");
+      ImGui::TableSetupColumn("ms", ImGuiTableColumnFlags_WidthFixed, 80.0F);
+      ImGui::TableHeadersRow();
+
+      for (U32 i = 0; i < frame.SampleCount; i++)
+      {
+        const ProfilerSample& sample = frame.Samples[i];
+
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::Text("%*s%s", (I32)sample.Depth * 2, "", sample.Name);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", sample.End - sample.Begin);
+      }
+
+      ImGui::EndTable();
+    }
+
+    if (ImGui::BeginTable("GPU", 2, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV))
+    {
+      ImGui::TableSetupColumn("GPU Scope");
+      ImGui::TableSetupColumn("ms", ImGuiTableColumnFlags_WidthFixed, 80.0F);
+      ImGui::TableHeadersRow();
+
+      for (U32 i = 0; i < frame.TimerCount; i++)
+      {
+        const ProfilerTimer& timer = frame.Timers[i];
+
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(timer.Name);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", timer.Time);
+      }
+
+      ImGui::EndTable();
+    }
+
+    ImGui::End();
+  }
+}
\ No newline at end of file
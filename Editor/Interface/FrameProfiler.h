@@ -0,0 +1,21 @@
+#pragma once
+
+#include <Common/Types.h>
+
+#include <Editor/Forward.h>
+#include <Editor/Interface.h>
+
+///////////////////////////////////////////////////////////
+// Definition
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  class FrameProfiler : public Interface
+  {
+  public:
+
+    virtual void Update() override;
+    virtual void Draw() override;
+  };
+}
\ No newline at end of file
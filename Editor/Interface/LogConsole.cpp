@@ -0,0 +1,75 @@
+#include <Common/Logger.h>
+
+#include <Editor/Interface/LogConsole.h>
+
+#include <Vendor/ImGui/imgui.h>
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static ImVec4 GetLevelColor(U32 Level)
+  {
+    switch (Level)
+    {
+      case eLogLevelTrace: return ImVec4{ 0.5F, 0.5F, 0.5F, 1.0F };
+      case eLogLevelDebug: return ImVec4{ 0.7F, 0.7F, 0.7F, 1.0F };
+      case eLogLevelWarning: return ImVec4{ 1.0F, 0.8F, 0.3F, 1.0F };
+      case eLogLevelError: return ImVec4{ 1.0F, 0.4F, 0.4F, 1.0F };
+    }
+
+    return ImVec4{ 1.0F, 1.0F, 1.0F, 1.0F };
+  }
+}
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  void LogConsole::Update()
+  {
+
+  }
+
+  void LogConsole::Draw()
+  {
+    ImGui::Begin("Log");
+
+    static const char* sLevelNames[] = { "Trace", "Debug", "Info", "Warning", "Error" };
+
+    ImGui::SetNextItemWidth(120.0F);
+    ImGui::Combo("Level", &mMinLevel, sLevelNames, IM_ARRAYSIZE(sLevelNames));
+    ImGui::SameLine();
+    ImGui::CheckboxFlags("Auto Scroll", &mAutoScroll, 1);
+    ImGui::SameLine();
+    ImGui::Text("Dropped: %llu", (unsigned long long)Logger::GetDropped());
+
+    ImGui::Separator();
+
+    if (ImGui::BeginChild("Messages"))
+    {
+      Logger::ForEachHistory([&](U32 Level, const std::string& Text)
+      {
+        if (Level >= (U32)mMinLevel)
+        {
+          ImGui::PushStyleColor(ImGuiCol_Text, GetLevelColor(Level));
+          ImGui::TextUnformatted(Text.data(), Text.data() + Text.size());
+          ImGui::PopStyleColor();
+        }
+      });
+
+      if (mAutoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
+      {
+        ImGui::SetScrollHereY(1.0F);
+      }
+    }
+
+    ImGui::EndChild();
+
+    ImGui::End();
+  }
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <Common/Types.h>
+
+#include <Editor/Forward.h>
+#include <Editor/Interface.h>
+
+///////////////////////////////////////////////////////////
+// Definition
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  class LogConsole : public Interface
+  {
+  public:
+
+    static constexpr U32 sHistorySize = 1024;
+
+  public:
+
+    virtual void Update() override;
+    virtual void Draw() override;
+
+  private:
+
+    I32 mMinLevel = 0;
+    U32 mAutoScroll = 1;
+  };
+}
\ No newline at end of file
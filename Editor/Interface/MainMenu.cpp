@@ -1,5 +1,6 @@
+#include <Common/Packer.h>
+
 #include <Editor/Scene.h>
-#include <Editor/Packer.h>
 
 #include <Editor/Interface/MainMenu.h>
 
@@ -11,6 +12,8 @@
 // Globals
 ///////////////////////////////////////////////////////////
 
+extern rj::Document gConfig;
+extern rj::Document gPacker;
 extern rj::Document gWorld;
 
 extern ark::Scene* gScene;
@@ -76,24 +79,24 @@ namespace ark
     {
       if (ImGui::Selectable("Unpack", false))
       {
-        Packer::Unpack();
+        Packer::Unpack(Packer::FromConfig(gConfig, gPacker));
       }
 
       if (ImGui::Selectable("Repack", false))
       {
-        Packer::Repack();
+        Packer::Repack(Packer::FromConfig(gConfig, gPacker));
       }
 
       ImGui::Separator();
 
       if (ImGui::Selectable("Check Integrity", false))
       {
-        Packer::CheckIntegrity();
+        Packer::CheckIntegrity(Packer::FromConfig(gConfig, gPacker));
       }
 
       if (ImGui::Selectable("Generate Integrity", false))
       {
-        Packer::GenerateIntegrityMap();
+        Packer::GenerateIntegrityMap(Packer::FromConfig(gConfig, gPacker));
       }
 
       ImGui::EndMenu();
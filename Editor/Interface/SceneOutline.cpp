@@ -13,6 +13,18 @@
 
 extern ark::Scene* gScene;
 
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static U64 EntityKey(Entity Entity)
+  {
+    return ((U64)Entity.Generation << 32) | (U64)Entity.Index;
+  }
+}
+
 ///////////////////////////////////////////////////////////
 // Implementation
 ///////////////////////////////////////////////////////////
@@ -21,57 +33,123 @@ namespace ark
 {
   void SceneOutline::Update()
   {
+    mRows.clear();
+
+    mScene = gScene;
+    mRevision = gScene ? gScene->GetRevision() : 0;
+    mRequiresRebuild = 0;
 
+    if (!gScene)
+    {
+      return;
+    }
+
+    for (auto& actor : gScene->GetActors())
+    {
+      if (actor->HasNoParent())
+      {
+        AddActorRowsRecursive(actor, 0);
+      }
+    }
   }
 
   void SceneOutline::Draw()
   {
+    if (mRequiresRebuild || mScene != gScene || (gScene && mRevision != gScene->GetRevision()))
+    {
+      Update();
+    }
+
     ImGui::Begin("Scene Outline");
 
-    if (gScene)
+    ImGuiListClipper clipper = {};
+
+    clipper.Begin((I32)mRows.size());
+
+    while (clipper.Step())
     {
-      for (auto& actor : gScene->GetActors())
+      for (I32 i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
       {
-        if (actor->HasNoParent())
-        {
-          DrawActorRecursive(actor);
-        }
+        DrawRow(mRows[i]);
       }
     }
 
     ImGui::End();
   }
 
-  void SceneOutline::DrawActorRecursive(Actor* Actor)
+  void SceneOutline::AddActorRowsRecursive(Actor* Actor, U32 Depth)
   {
-    std::uint32_t flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_SpanFullWidth;
-
-    if (Actor == mSelectedActor) flags |= ImGuiTreeNodeFlags_Selected;
+    mRows.emplace_back(OutlineRow{ Actor->GetEntity(), Depth, eOutlineRowActor });
 
-    if (Actor->IsChild())
+    if (mOpenEntities.contains(EntityKey(Actor->GetEntity())))
     {
-      flags |= ImGuiTreeNodeFlags_Leaf;
+      mRows.emplace_back(OutlineRow{ Actor->GetEntity(), Depth + 1, eOutlineRowPosition });
+      mRows.emplace_back(OutlineRow{ Actor->GetEntity(), Depth + 1, eOutlineRowRotation });
+      mRows.emplace_back(OutlineRow{ Actor->GetEntity(), Depth + 1, eOutlineRowScale });
+
+      for (auto& child : *Actor)
+      {
+        AddActorRowsRecursive(child, Depth + 1);
+      }
     }
+  }
 
-    std::uint32_t opened = ImGui::TreeNodeEx(Actor->GetName().c_str(), flags);
+  void SceneOutline::DrawRow(const OutlineRow& Row)
+  {
+    Actor* actor = gScene ? gScene->GetActor(Row.ActorEntity) : nullptr;
 
-    if (ImGui::IsItemClicked(0) || ImGui::IsItemClicked(1))
+    if (!actor)
     {
-      mSelectedActor = Actor;
+      ImGui::NewLine();
+
+      return;
     }
 
-    if (opened)
-    {
-      ImGui::Text("Position: [%f,%f,%f]", Actor->GetTransform()->GetWorldPosition().x, Actor->GetTransform()->GetWorldPosition().y, Actor->GetTransform()->GetWorldPosition().z);
-      ImGui::Text("Rotation: [%f,%f,%f]", Actor->GetTransform()->GetWorldRotation().x, Actor->GetTransform()->GetWorldRotation().y, Actor->GetTransform()->GetWorldRotation().z);
-      ImGui::Text("Scale   : [%f,%f,%f]", Actor->GetTransform()->GetWorldScale().x, Actor->GetTransform()->GetWorldScale().y, Actor->GetTransform()->GetWorldScale().z);
+    R32 indent = ImGui::GetStyle().IndentSpacing * Row.Depth;
 
-      for (auto& child : *Actor)
+    if (indent > 0.0F) ImGui::Indent(indent);
+
+    switch (Row.Type)
+    {
+      case eOutlineRowActor:
       {
-        DrawActorRecursive(child);
-      }
+        std::uint32_t flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_SpanFullWidth | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+
+        if (Row.ActorEntity == mSelectedEntity) flags |= ImGuiTreeNodeFlags_Selected;
+
+        if (actor->IsChild())
+        {
+          flags |= ImGuiTreeNodeFlags_Leaf;
+        }
 
-      ImGui::TreePop();
+        // Open state is owned by the outline so the flattened rows can follow it
+
+        U64 key = EntityKey(Row.ActorEntity);
+        U32 open = mOpenEntities.contains(key);
+
+        ImGui::SetNextItemOpen(open);
+
+        U32 opened = ImGui::TreeNodeEx((void*)(std::uintptr_t)key, flags, "%s", actor->GetName().c_str());
+
+        if (ImGui::IsItemClicked(0) || ImGui::IsItemClicked(1))
+        {
+          mSelectedEntity = Row.ActorEntity;
+        }
+
+        if (opened != open)
+        {
+          if (opened) mOpenEntities.emplace(key); else mOpenEntities.erase(key);
+
+          mRequiresRebuild = 1;
+        }
+
+        break;
+      }
+      case eOutlineRowPosition: ImGui::Text("Position: [%f,%f,%f]", actor->GetTransform()->GetWorldPosition().x, actor->GetTransform()->GetWorldPosition().y, actor->GetTransform()->GetWorldPosition().z); break;
+      case eOutlineRowRotation: ImGui::Text("Rotation: [%f,%f,%f]", actor->GetTransform()->GetWorldRotation().x, actor->GetTransform()->GetWorldRotation().y, actor->GetTransform()->GetWorldRotation().z); break;
+      case eOutlineRowScale: ImGui::Text("Scale   : [%f,%f,%f]", actor->GetTransform()->GetWorldScale().x, actor->GetTransform()->GetWorldScale().y, actor->GetTransform()->GetWorldScale().z); break;
     }
+
+    if (indent > 0.0F) ImGui::Unindent(indent);
   }
 }
\ No newline at end of file
@@ -1,9 +1,14 @@
 #pragma once
 
+#include <cstdint>
+#include <set>
+#include <vector>
+
 #include <Common/Types.h>
 
 #include <Editor/Forward.h>
 #include <Editor/Interface.h>
+#include <Editor/Registry.h>
 
 ///////////////////////////////////////////////////////////
 // Definition
@@ -11,8 +16,29 @@
 
 namespace ark
 {
+  /*
+   * The visible part of the actor tree is flattened into rows, which are rebuilt once the
+   * scene revision moved or a node was toggled. Only the rows in view are submitted.
+   */
   class SceneOutline : public Interface
   {
+  private:
+
+    enum OutlineRowType
+    {
+      eOutlineRowActor = 0,
+      eOutlineRowPosition = 1,
+      eOutlineRowRotation = 2,
+      eOutlineRowScale = 3,
+    };
+
+    struct OutlineRow
+    {
+      Entity ActorEntity;
+      U32 Depth;
+      OutlineRowType Type;
+    };
+
   public:
 
     virtual void Update() override;
@@ -20,10 +46,19 @@ namespace ark
 
   private:
 
-    void DrawActorRecursive(Actor* Actor);
+    void AddActorRowsRecursive(Actor* Actor, U32 Depth);
+
+    void DrawRow(const OutlineRow& Row);
 
   private:
 
-    Actor* mSelectedActor = nullptr;
+    std::vector<OutlineRow> mRows = {};
+    std::set<U64> mOpenEntities = {};
+
+    Scene* mScene = nullptr;
+    U64 mRevision = 0;
+    U32 mRequiresRebuild = 1;
+
+    Entity mSelectedEntity = {};
   };
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include <utility>
 
 #include <Common/Types.h>
 
@@ -18,20 +19,32 @@ namespace ark
   {
     eRenderModeLines = 1,
     eRenderModeTriangles = 4,
+    eRenderModeTriangleStrip = 5,
   };
 
   template<typename V, typename E>
   class Mesh
   {
+  public:
+
+    static constexpr U32 sElementType = (sizeof(E) == sizeof(U16)) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+
   public:
 
     Mesh();
+    Mesh(const Mesh& Other) = delete;
+    Mesh(Mesh&& Other) noexcept;
     virtual ~Mesh();
 
+  public:
+
+    inline auto GetVao() const { return mVao; }
+
   public:
 
     void Bind() const;
     void Render(RenderMode RenderMode) const;
+    void RenderInstanced(RenderMode RenderMode, U32 InstanceCount) const;
     void UnBind() const;
 
   public:
@@ -41,9 +54,9 @@ namespace ark
 
   private:
 
-    U32 mVao;
-    U32 mVbo;
-    U32 mEbo;
+    U32 mVao = 0;
+    U32 mVbo = 0;
+    U32 mEbo = 0;
 
     U32 mElementSize = 0;
   };
@@ -76,10 +89,10 @@ namespace ark
         glEnableVertexAttribArray(1);
         glEnableVertexAttribArray(2);
         glEnableVertexAttribArray(3);
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(DefaultVertex), (void*)(0));
-        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(DefaultVertex), (void*)(sizeof(R32V3)));
-        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(DefaultVertex), (void*)(sizeof(R32V3) + sizeof(R32V2)));
-        glVertexAttribPointer(3, 1, GL_UNSIGNED_INT, GL_FALSE, sizeof(DefaultVertex), (void*)(sizeof(R32V3) + sizeof(R32V2) + sizeof(R32V2)));
+        glVertexAttribPointer(0, 3, GL_SHORT, GL_FALSE, sizeof(DefaultVertex), (void*)(0));
+        glVertexAttribIPointer(1, 2, GL_UNSIGNED_SHORT, sizeof(DefaultVertex), (void*)(sizeof(I16V3) + sizeof(U16)));
+        glVertexAttribPointer(2, 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(DefaultVertex), (void*)(sizeof(I16V3) + sizeof(U16) + sizeof(U16V2)));
+        glVertexAttribIPointer(3, 1, GL_UNSIGNED_INT, sizeof(DefaultVertex), (void*)(sizeof(I16V3) + sizeof(U16) + sizeof(U16V2) + sizeof(U16V2)));
         break;
       }
       case VertexType::eVertexTypeDebug:
@@ -98,6 +111,16 @@ namespace ark
     glBindVertexArray(0);
   }
 
+  template<typename V, typename E>
+  Mesh<V, E>::Mesh(Mesh&& Other) noexcept
+    : mVao{ std::exchange(Other.mVao, 0) }
+    , mVbo{ std::exchange(Other.mVbo, 0) }
+    , mEbo{ std::exchange(Other.mEbo, 0) }
+    , mElementSize{ std::exchange(Other.mElementSize, 0) }
+  {
+
+  }
+
   template<typename V, typename E>
   Mesh<V, E>::~Mesh()
   {
@@ -116,7 +139,13 @@ namespace ark
   template<typename V, typename E>
   void Mesh<V, E>::Render(RenderMode renderMode) const
   {
-    glDrawElements(renderMode, mElementSize, GL_UNSIGNED_INT, NULL);
+    glDrawElements(renderMode, mElementSize, sElementType, NULL);
+  }
+
+  template<typename V, typename E>
+  void Mesh<V, E>::RenderInstanced(RenderMode renderMode, U32 InstanceCount) const
+  {
+    glDrawElementsInstanced(renderMode, mElementSize, sElementType, NULL, InstanceCount);
   }
 
   template<typename V, typename E>
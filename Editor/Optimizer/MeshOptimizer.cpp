@@ -0,0 +1,375 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <Editor/Assets/Model.h>
+
+#include <Editor/Optimizer/MeshOptimizer.h>
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static R32 VertexScore(I32 CachePosition, U32 ActiveTriangles)
+  {
+    if (ActiveTriangles == 0)
+    {
+      return -1.0F;
+    }
+
+    R32 score = 0.0F;
+
+    if (CachePosition >= 0)
+    {
+      if (CachePosition < 3)
+      {
+        score = 0.75F;
+      }
+      else
+      {
+        score = std::pow(1.0F - (R32)(CachePosition - 3) / (R32)(MeshOptimizer::sCacheSize - 3), 1.5F);
+      }
+    }
+
+    return score + 2.0F / std::sqrt((R32)ActiveTriangles);
+  }
+}
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  void MeshOptimizer::Optimize(ModelDivision& ModelDivision)
+  {
+    std::vector<DefaultVertex> vertices = { ModelDivision.GetVertexBuffer().begin(), ModelDivision.GetVertexBuffer().end() };
+    std::vector<U16> triangles = Triangulate({ ModelDivision.GetElementBuffer().begin(), ModelDivision.GetElementBuffer().end() });
+
+    if (triangles.empty())
+    {
+      return;
+    }
+
+    DeduplicateVertices(vertices, triangles);
+    OptimizeVertexCache(triangles, (U32)vertices.size());
+    OptimizeVertexFetch(vertices, triangles);
+
+    std::vector<U16> strips = Stripify(triangles);
+
+    ModelDivision.SetVertexBuffer(vertices.data(), vertices.size());
+    ModelDivision.SetElementBuffer(strips.data(), strips.size());
+  }
+
+  std::vector<U16> MeshOptimizer::Triangulate(const std::vector<U16>& Strips)
+  {
+    std::vector<U16> triangles = {};
+
+    triangles.reserve(Strips.size() * 3);
+
+    U64 stripStart = 0;
+
+    for (U64 i = 0; i <= Strips.size(); i++)
+    {
+      if (i < Strips.size() && Strips[i] != sRestartIndex)
+      {
+        continue;
+      }
+
+      for (U64 j = stripStart; (j + 2) < i; j++)
+      {
+        U16 a = Strips[j + 0];
+        U16 b = Strips[j + 1];
+        U16 c = Strips[j + 2];
+
+        if (a == b || b == c || a == c)
+        {
+          continue;
+        }
+
+        if ((j - stripStart) & 1)
+        {
+          std::swap(a, b);
+        }
+
+        triangles.emplace_back(a);
+        triangles.emplace_back(b);
+        triangles.emplace_back(c);
+      }
+
+      stripStart = i + 1;
+    }
+
+    return triangles;
+  }
+
+  std::vector<U16> MeshOptimizer::Stripify(const std::vector<U16>& Triangles)
+  {
+    std::vector<U16> strips = {};
+
+    strips.reserve(Triangles.size() + Triangles.size() / 3);
+
+    U64 stripSize = 0;
+
+    for (U64 i = 0; i < Triangles.size(); i += 3)
+    {
+      const U16* triangle = &Triangles[i];
+
+      // Continue the current strip if the triangle shares its last edge, winding is not preserved
+
+      if (stripSize >= 3)
+      {
+        U16 x = strips[strips.size() - 2];
+        U16 y = strips[strips.size() - 1];
+
+        U32 sharedCount = 0;
+        U16 opposite = sRestartIndex;
+
+        for (U32 j = 0; j < 3; j++)
+        {
+          if (triangle[j] == x || triangle[j] == y)
+          {
+            sharedCount++;
+          }
+          else
+          {
+            opposite = triangle[j];
+          }
+        }
+
+        if (sharedCount == 2 && opposite != sRestartIndex)
+        {
+          strips.emplace_back(opposite);
+
+          stripSize++;
+
+          continue;
+        }
+      }
+
+      if (!strips.empty())
+      {
+        strips.emplace_back(sRestartIndex);
+      }
+
+      strips.emplace_back(triangle[0]);
+      strips.emplace_back(triangle[1]);
+      strips.emplace_back(triangle[2]);
+
+      stripSize = 3;
+    }
+
+    return strips;
+  }
+
+  void MeshOptimizer::DeduplicateVertices(std::vector<DefaultVertex>& Vertices, std::vector<U16>& Triangles)
+  {
+    // The connection flag only encodes strip topology, which is gone at this point
+
+    for (auto& vertex : Vertices)
+    {
+      vertex.Connection = 0;
+    }
+
+    std::vector<U16> order = std::vector<U16>(Vertices.size());
+
+    for (U64 i = 0; i < order.size(); i++)
+    {
+      order[i] = (U16)i;
+    }
+
+    std::sort(order.begin(), order.end(), [&](U16 A, U16 B)
+    {
+      I32 result = std::memcmp(&Vertices[A], &Vertices[B], sizeof(DefaultVertex));
+
+      return (result == 0) ? (A < B) : (result < 0);
+    });
+
+    std::vector<U16> remap = std::vector<U16>(Vertices.size());
+
+    U16 unique = 0;
+
+    for (U64 i = 0; i < order.size(); i++)
+    {
+      if (i == 0 || std::memcmp(&Vertices[order[i - 1]], &Vertices[order[i]], sizeof(DefaultVertex)) != 0)
+      {
+        unique = order[i];
+      }
+
+      remap[order[i]] = unique;
+    }
+
+    for (auto& index : Triangles)
+    {
+      index = remap[index];
+    }
+  }
+
+  void MeshOptimizer::OptimizeVertexCache(std::vector<U16>& Triangles, U32 VertexCount)
+  {
+    U32 triangleCount = (U32)(Triangles.size() / 3);
+
+    std::vector<U32> activeTriangles = std::vector<U32>(VertexCount, 0);
+    std::vector<U32> adjacencyOffsets = std::vector<U32>(VertexCount + 1, 0);
+    std::vector<U32> adjacency = std::vector<U32>(Triangles.size());
+
+    for (U16 index : Triangles)
+    {
+      activeTriangles[index]++;
+    }
+
+    for (U32 i = 0; i < VertexCount; i++)
+    {
+      adjacencyOffsets[i + 1] = adjacencyOffsets[i] + activeTriangles[i];
+    }
+
+    std::vector<U32> adjacencyFill = std::vector<U32>(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+
+    for (U32 i = 0; i < (U32)Triangles.size(); i++)
+    {
+      adjacency[adjacencyFill[Triangles[i]]++] = i / 3;
+    }
+
+    std::vector<I32> cachePositions = std::vector<I32>(VertexCount, -1);
+    std::vector<R32> vertexScores = std::vector<R32>(VertexCount, 0.0F);
+    std::vector<R32> triangleScores = std::vector<R32>(triangleCount, 0.0F);
+    std::vector<U8> triangleEmitted = std::vector<U8>(triangleCount, 0);
+
+    for (U32 i = 0; i < VertexCount; i++)
+    {
+      vertexScores[i] = VertexScore(-1, activeTriangles[i]);
+    }
+
+    for (U32 i = 0; i < triangleCount; i++)
+    {
+      triangleScores[i] = vertexScores[Triangles[i * 3 + 0]] + vertexScores[Triangles[i * 3 + 1]] + vertexScores[Triangles[i * 3 + 2]];
+    }
+
+    std::vector<U16> triangles = {};
+    std::vector<U32> cache = {};
+    std::vector<U32> nextCache = {};
+
+    triangles.reserve(Triangles.size());
+    cache.reserve(sCacheSize + 3);
+    nextCache.reserve(sCacheSize + 3);
+
+    U32 bestTriangle = 0xFFFFFFFF;
+    U32 scanCursor = 0;
+
+    for (U32 emitted = 0; emitted < triangleCount; emitted++)
+    {
+      if (bestTriangle == 0xFFFFFFFF)
+      {
+        // Nothing left around the cache, fall back to the best remaining triangle
+
+        R32 bestScore = -1.0F;
+
+        while (triangleEmitted[scanCursor])
+        {
+          scanCursor++;
+        }
+
+        for (U32 i = scanCursor; i < triangleCount; i++)
+        {
+          if (!triangleEmitted[i] && triangleScores[i] > bestScore)
+          {
+            bestScore = triangleScores[i];
+            bestTriangle = i;
+          }
+        }
+      }
+
+      const U16* triangle = &Triangles[bestTriangle * 3];
+
+      triangles.insert(triangles.end(), triangle, triangle + 3);
+      triangleEmitted[bestTriangle] = 1;
+
+      nextCache.clear();
+
+      for (U32 i = 0; i < 3; i++)
+      {
+        U16 vertex = triangle[i];
+
+        U32* begin = &adjacency[adjacencyOffsets[vertex]];
+        U32* end = begin + activeTriangles[vertex];
+
+        std::iter_swap(std::find(begin, end, bestTriangle), end - 1);
+
+        activeTriangles[vertex]--;
+
+        nextCache.emplace_back(vertex);
+      }
+
+      for (U32 vertex : cache)
+      {
+        if (vertex != triangle[0] && vertex != triangle[1] && vertex != triangle[2])
+        {
+          nextCache.emplace_back(vertex);
+        }
+      }
+
+      for (U32 i = 0; i < (U32)nextCache.size(); i++)
+      {
+        cachePositions[nextCache[i]] = (i < sCacheSize) ? (I32)i : -1;
+      }
+
+      bestTriangle = 0xFFFFFFFF;
+
+      R32 bestScore = -1.0F;
+
+      for (U32 vertex : nextCache)
+      {
+        R32 score = VertexScore(cachePositions[vertex], activeTriangles[vertex]);
+        R32 delta = score - vertexScores[vertex];
+
+        vertexScores[vertex] = score;
+
+        for (U32 i = 0; i < activeTriangles[vertex]; i++)
+        {
+          U32 adjacentTriangle = adjacency[adjacencyOffsets[vertex] + i];
+
+          triangleScores[adjacentTriangle] += delta;
+
+          if (triangleScores[adjacentTriangle] > bestScore)
+          {
+            bestScore = triangleScores[adjacentTriangle];
+            bestTriangle = adjacentTriangle;
+          }
+        }
+      }
+
+      if (nextCache.size() > sCacheSize)
+      {
+        nextCache.resize(sCacheSize);
+      }
+
+      std::swap(cache, nextCache);
+    }
+
+    Triangles = std::move(triangles);
+  }
+
+  void MeshOptimizer::OptimizeVertexFetch(std::vector<DefaultVertex>& Vertices, std::vector<U16>& Triangles)
+  {
+    std::vector<U16> remap = std::vector<U16>(Vertices.size(), sRestartIndex);
+    std::vector<DefaultVertex> vertices = {};
+
+    vertices.reserve(Vertices.size());
+
+    for (auto& index : Triangles)
+    {
+      if (remap[index] == sRestartIndex)
+      {
+        remap[index] = (U16)vertices.size();
+
+        vertices.emplace_back(Vertices[index]);
+      }
+
+      index = remap[index];
+    }
+
+    Vertices = std::move(vertices);
+  }
+}
\ No newline at end of file
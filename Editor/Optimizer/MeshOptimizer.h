@@ -0,0 +1,44 @@
+#pragma once
+
+#include <vector>
+
+#include <Common/Types.h>
+
+#include <Editor/Forward.h>
+#include <Editor/Vertex.h>
+
+///////////////////////////////////////////////////////////
+// Definition
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  /*
+   * Offline clean up of model divisions before they reach the GPU.
+   *
+   * Strips are expanded into triangles, duplicate vertices are merged, triangles
+   * are re-ordered for the post-transform cache using Forsyth's algorithm and
+   * vertices are re-ordered by first use. The result is stitched back together
+   * into restart separated strips.
+   */
+  class MeshOptimizer
+  {
+  public:
+
+    static constexpr U16 sRestartIndex = 0xFFFF;
+    static constexpr U32 sCacheSize = 32;
+
+  public:
+
+    static void Optimize(ModelDivision& ModelDivision);
+
+  private:
+
+    static std::vector<U16> Triangulate(const std::vector<U16>& Strips);
+    static std::vector<U16> Stripify(const std::vector<U16>& Triangles);
+
+    static void DeduplicateVertices(std::vector<DefaultVertex>& Vertices, std::vector<U16>& Triangles);
+    static void OptimizeVertexCache(std::vector<U16>& Triangles, U32 VertexCount);
+    static void OptimizeVertexFetch(std::vector<DefaultVertex>& Vertices, std::vector<U16>& Triangles);
+  };
+}
\ No newline at end of file
@@ -0,0 +1,155 @@
+#include <Editor/Profiler.h>
+
+#include <Vendor/GLAD/glad.h>
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  void Profiler::BeginFrame()
+  {
+    sFrameIndex = sFrameNumber % sFrameCount;
+
+    ProfilerFrame& frame = sFrames[sFrameIndex];
+
+    // The slot about to be reused holds the oldest frame, its queries had the most time to finish
+
+    if (sFrameNumber >= sFrameCount)
+    {
+      Resolve(frame);
+    }
+
+    frame.SampleCount = 0;
+    frame.TimerCount = 0;
+    frame.DrawCalls = 0;
+    frame.UploadBytes = 0;
+    frame.CpuTime = 0.0;
+
+    sDepth = 0;
+    sFrameBegin = std::chrono::steady_clock::now();
+  }
+
+  void Profiler::EndFrame()
+  {
+    ProfilerFrame& frame = sFrames[sFrameIndex];
+
+    frame.CpuTime = GetTime();
+
+    sFrameTimes[sFrameTimeOffset] = (R32)frame.CpuTime;
+    sFrameTimeOffset = (sFrameTimeOffset + 1) % sHistorySize;
+
+    sFrameNumber++;
+  }
+
+  void Profiler::Destroy()
+  {
+    for (auto& frame : sFrames)
+    {
+      for (auto& timer : frame.Timers)
+      {
+        if (timer.Query)
+        {
+          glDeleteQueries(1, &timer.Query);
+
+          timer.Query = 0;
+        }
+      }
+
+      frame.TimerCount = 0;
+    }
+  }
+
+  void Profiler::BeginCpuScope(const char* Name)
+  {
+    ProfilerFrame& frame = sFrames[sFrameIndex];
+
+    if (frame.SampleCount < ProfilerFrame::sMaxSamples && sDepth < sMaxDepth)
+    {
+      frame.Samples[frame.SampleCount] = ProfilerSample{ Name, sDepth, GetTime(), 0.0 };
+
+      sStack[sDepth] = frame.SampleCount++;
+    }
+    else
+    {
+      sStack[sDepth % sMaxDepth] = ProfilerFrame::sMaxSamples;
+    }
+
+    sDepth++;
+  }
+
+  void Profiler::EndCpuScope()
+  {
+    sDepth--;
+
+    U32 index = sStack[sDepth % sMaxDepth];
+
+    if (index < ProfilerFrame::sMaxSamples)
+    {
+      sFrames[sFrameIndex].Samples[index].End = GetTime();
+    }
+  }
+
+  void Profiler::BeginGpuScope(const char* Name)
+  {
+    ProfilerFrame& frame = sFrames[sFrameIndex];
+
+    // Elapsed time queries can not be nested, inner scopes are dropped
+
+    if (sGpuScopeOpen || frame.TimerCount == ProfilerFrame::sMaxTimers)
+    {
+      sGpuScopeOpen++;
+
+      return;
+    }
+
+    ProfilerTimer& timer = frame.Timers[frame.TimerCount++];
+
+    if (!timer.Query)
+    {
+      glCreateQueries(GL_TIME_ELAPSED, 1, &timer.Query);
+    }
+
+    timer.Name = Name;
+    timer.Time = 0.0;
+
+    glBeginQuery(GL_TIME_ELAPSED, timer.Query);
+
+    sGpuScopeOpen++;
+    sGpuQueryActive = 1;
+  }
+
+  void Profiler::EndGpuScope()
+  {
+    sGpuScopeOpen--;
+
+    if (sGpuScopeOpen == 0 && sGpuQueryActive)
+    {
+      glEndQuery(GL_TIME_ELAPSED);
+
+      sGpuQueryActive = 0;
+    }
+  }
+
+  R64 Profiler::GetTime()
+  {
+    return std::chrono::duration<R64, std::milli>(std::chrono::steady_clock::now() - sFrameBegin).count();
+  }
+
+  void Profiler::Resolve(ProfilerFrame& Frame)
+  {
+    for (U32 i = 0; i < Frame.TimerCount; i++)
+    {
+      ProfilerTimer& timer = Frame.Timers[i];
+
+      GLuint64 elapsed = 0;
+
+      glGetQueryObjectui64v(timer.Query, GL_QUERY_RESULT, &elapsed);
+
+      timer.Time = (R64)elapsed / 1000000.0;
+    }
+
+    sResolvedFrame = Frame;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <chrono>
+
+#include <Common/Types.h>
+
+///////////////////////////////////////////////////////////
+// Definition
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  struct ProfilerSample
+  {
+    const char* Name;
+    U32 Depth;
+    R64 Begin;
+    R64 End;
+  };
+
+  struct ProfilerTimer
+  {
+    const char* Name;
+    U32 Query;
+    R64 Time;
+  };
+
+  struct ProfilerFrame
+  {
+    static constexpr U32 sMaxSamples = 256;
+    static constexpr U32 sMaxTimers = 8;
+
+    ProfilerSample Samples[sMaxSamples];
+    ProfilerTimer Timers[sMaxTimers];
+
+    U32 SampleCount;
+    U32 TimerCount;
+    U32 DrawCalls;
+    U64 UploadBytes;
+    R64 CpuTime;
+  };
+
+  /*
+   * Per frame CPU and GPU instrumentation.
+   *
+   * Every frame records into its own slot of a small ring of fixed size frames,
+   * so opening a scope is a clock read and an array write. GPU timer queries are
+   * only resolved once their slot comes around again, a few frames later, which
+   * avoids stalling on results. The most recently resolved frame is published
+   * together with a history of frame times.
+   */
+  class Profiler
+  {
+  public:
+
+    static constexpr U32 sFrameCount = 4;
+    static constexpr U32 sHistorySize = 240;
+    static constexpr U32 sMaxDepth = 32;
+
+  public:
+
+    static inline const auto& GetResolvedFrame() { return sResolvedFrame; }
+    static inline const auto& GetFrameTimes() { return sFrameTimes; }
+    static inline auto GetFrameTimeOffset() { return sFrameTimeOffset; }
+
+  public:
+
+    static void BeginFrame();
+    static void EndFrame();
+    static void Destroy();
+
+  public:
+
+    static void BeginCpuScope(const char* Name);
+    static void EndCpuScope();
+
+    static void BeginGpuScope(const char* Name);
+    static void EndGpuScope();
+
+  public:
+
+    static inline void CountDrawCalls(U32 Count) { sFrames[sFrameIndex].DrawCalls += Count; }
+    static inline void CountUploadBytes(U64 Size) { sFrames[sFrameIndex].UploadBytes += Size; }
+
+  private:
+
+    static R64 GetTime();
+
+    static void Resolve(ProfilerFrame& Frame);
+
+  private:
+
+    static inline ProfilerFrame sFrames[sFrameCount] = {};
+    static inline ProfilerFrame sResolvedFrame = {};
+
+    static inline U32 sFrameIndex = 0;
+    static inline U32 sFrameNumber = 0;
+    static inline std::chrono::steady_clock::time_point sFrameBegin = {};
+
+    static inline U32 sStack[sMaxDepth] = {};
+    static inline U32 sDepth = 0;
+    static inline U32 sGpuScopeOpen = 0;
+    static inline U32 sGpuQueryActive = 0;
+
+    static inline R32 sFrameTimes[sHistorySize] = {};
+    static inline U32 sFrameTimeOffset = 0;
+  };
+
+  class ProfilerCpuScope
+  {
+  public:
+
+    inline ProfilerCpuScope(const char* Name) { Profiler::BeginCpuScope(Name); }
+    inline ~ProfilerCpuScope() { Profiler::EndCpuScope(); }
+  };
+
+  class ProfilerGpuScope
+  {
+  public:
+
+    inline ProfilerGpuScope(const char* Name) { Profiler::BeginGpuScope(Name); }
+    inline ~ProfilerGpuScope() { Profiler::EndGpuScope(); }
+  };
+}
\ No newline at end of file
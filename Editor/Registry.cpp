@@ -0,0 +1,69 @@
+#include <Editor/Registry.h>
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  Registry::Registry(std::pmr::memory_resource* Resource)
+    : mResource{ Resource }
+  {
+
+  }
+
+  Registry::~Registry()
+  {
+    for (auto& pool : mPools)
+    {
+      delete pool;
+      pool = nullptr;
+    }
+  }
+
+  Entity Registry::CreateEntity()
+  {
+    Entity entity = {};
+
+    if (mFreeIndices.empty())
+    {
+      entity.Index = (U32)mGenerations.size();
+      entity.Generation = 0;
+
+      mGenerations.emplace_back(0);
+    }
+    else
+    {
+      entity.Index = mFreeIndices.back();
+      entity.Generation = mGenerations[entity.Index];
+
+      mFreeIndices.pop_back();
+    }
+
+    return entity;
+  }
+
+  void Registry::DestroyEntity(Entity Entity)
+  {
+    if (!IsAlive(Entity))
+    {
+      return;
+    }
+
+    for (auto& pool : mPools)
+    {
+      if (pool)
+      {
+        pool->Remove(Entity.Index);
+      }
+    }
+
+    mGenerations[Entity.Index]++;
+    mFreeIndices.emplace_back(Entity.Index);
+  }
+
+  U32 Registry::IsAlive(Entity Entity) const
+  {
+    return Entity.Index < mGenerations.size() && mGenerations[Entity.Index] == Entity.Generation;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,297 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <memory_resource>
+
+#include <Common/Types.h>
+
+#include <Editor/Component.h>
+
+///////////////////////////////////////////////////////////
+// Definition
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  struct Entity
+  {
+    U32 Index = 0xFFFFFFFF;
+    U32 Generation = 0;
+
+    bool operator == (const Entity& Other) const = default;
+  };
+
+  class ComponentPoolBase
+  {
+  public:
+
+    virtual ~ComponentPoolBase() = default;
+
+  public:
+
+    virtual U32 Contains(U32 EntityIndex) const = 0;
+    virtual void Remove(U32 EntityIndex) = 0;
+  };
+
+  /*
+   * Densely packed storage for one component type.
+   *
+   * Components live in fixed size pages, so adding components never relocates
+   * existing ones. Removing a component moves the last one into the hole.
+   */
+  template<typename C>
+  class ComponentPool : public ComponentPoolBase
+  {
+  public:
+
+    static constexpr U32 sPageSize = 1024;
+    static constexpr U32 sInvalidIndex = 0xFFFFFFFF;
+
+  public:
+
+    ComponentPool(std::pmr::memory_resource* Resource);
+    virtual ~ComponentPool();
+
+  public:
+
+    inline auto GetCount() const { return mCount; }
+    inline auto GetEntityIndex(U32 Index) const { return mEntities[Index]; }
+
+    inline C& At(U32 Index) { return mPages[Index / sPageSize][Index % sPageSize]; }
+    inline const C& At(U32 Index) const { return mPages[Index / sPageSize][Index % sPageSize]; }
+
+  public:
+
+    virtual U32 Contains(U32 EntityIndex) const override;
+    virtual void Remove(U32 EntityIndex) override;
+
+  public:
+
+    C* Find(U32 EntityIndex);
+
+    template<typename ... Args>
+    C* Emplace(U32 EntityIndex, Args&& ... Arguments);
+
+  private:
+
+    std::vector<U32> mSparse = {};
+    std::vector<U32> mEntities = {};
+    std::vector<C*> mPages = {};
+
+    std::pmr::polymorphic_allocator<C> mAllocator;
+
+    U32 mCount = 0;
+  };
+
+  class Registry
+  {
+  public:
+
+    Registry(std::pmr::memory_resource* Resource = std::pmr::get_default_resource());
+    virtual ~Registry();
+
+  public:
+
+    Entity CreateEntity();
+    void DestroyEntity(Entity Entity);
+
+    U32 IsAlive(Entity Entity) const;
+
+  public:
+
+    template<typename C>
+    ComponentPool<C>& GetPool();
+
+    template<typename C, typename ... Args>
+    C* Emplace(Entity Entity, Args&& ... Arguments);
+
+    template<typename C>
+    C* Get(Entity Entity);
+
+    template<typename C>
+    void Remove(Entity Entity);
+
+  public:
+
+    template<typename C, typename ... Cs, typename F>
+    void Each(F&& Function);
+
+  private:
+
+    std::vector<U32> mGenerations = {};
+    std::vector<U32> mFreeIndices = {};
+
+    std::pmr::memory_resource* mResource;
+
+    ComponentPoolBase* mPools[eComponentTypeCount] = {};
+  };
+}
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  template<typename C>
+  ComponentPool<C>::ComponentPool(std::pmr::memory_resource* Resource)
+    : mAllocator{ Resource }
+  {
+
+  }
+
+  template<typename C>
+  ComponentPool<C>::~ComponentPool()
+  {
+    for (U32 i = 0; i < mCount; i++)
+    {
+      At(i).~C();
+    }
+
+    for (auto& page : mPages)
+    {
+      mAllocator.deallocate(page, sPageSize);
+      page = nullptr;
+    }
+  }
+
+  template<typename C>
+  U32 ComponentPool<C>::Contains(U32 EntityIndex) const
+  {
+    return EntityIndex < mSparse.size() && mSparse[EntityIndex] != sInvalidIndex;
+  }
+
+  template<typename C>
+  void ComponentPool<C>::Remove(U32 EntityIndex)
+  {
+    if (!Contains(EntityIndex))
+    {
+      return;
+    }
+
+    U32 index = mSparse[EntityIndex];
+    U32 last = mCount - 1;
+
+    At(index).~C();
+
+    if (index != last)
+    {
+      new (&At(index)) C{ std::move(At(last)) };
+
+      At(last).~C();
+
+      mEntities[index] = mEntities[last];
+      mSparse[mEntities[index]] = index;
+    }
+
+    mSparse[EntityIndex] = sInvalidIndex;
+    mEntities.pop_back();
+
+    mCount--;
+  }
+
+  template<typename C>
+  C* ComponentPool<C>::Find(U32 EntityIndex)
+  {
+    return Contains(EntityIndex) ? &At(mSparse[EntityIndex]) : nullptr;
+  }
+
+  template<typename C>
+  template<typename ... Args>
+  C* ComponentPool<C>::Emplace(U32 EntityIndex, Args&& ... Arguments)
+  {
+    if (Contains(EntityIndex))
+    {
+      return &At(mSparse[EntityIndex]);
+    }
+
+    if (EntityIndex >= mSparse.size())
+    {
+      mSparse.resize(EntityIndex + 1, sInvalidIndex);
+    }
+
+    if (mCount == mPages.size() * sPageSize)
+    {
+      mPages.emplace_back(mAllocator.allocate(sPageSize));
+    }
+
+    C* component = new (&At(mCount)) C{ std::forward<Args>(Arguments) ... };
+
+    mSparse[EntityIndex] = mCount;
+    mEntities.emplace_back(EntityIndex);
+
+    mCount++;
+
+    return component;
+  }
+
+  template<typename C>
+  ComponentPool<C>& Registry::GetPool()
+  {
+    if (!mPools[C::Type])
+    {
+      mPools[C::Type] = new ComponentPool<C>{ mResource };
+    }
+
+    return *(ComponentPool<C>*)mPools[C::Type];
+  }
+
+  template<typename C, typename ... Args>
+  C* Registry::Emplace(Entity Entity, Args&& ... Arguments)
+  {
+    return GetPool<C>().Emplace(Entity.Index, std::forward<Args>(Arguments) ...);
+  }
+
+  template<typename C>
+  C* Registry::Get(Entity Entity)
+  {
+    if (!mPools[C::Type] || !IsAlive(Entity))
+    {
+      return nullptr;
+    }
+
+    return ((ComponentPool<C>*)mPools[C::Type])->Find(Entity.Index);
+  }
+
+  template<typename C>
+  void Registry::Remove(Entity Entity)
+  {
+    if (mPools[C::Type] && IsAlive(Entity))
+    {
+      mPools[C::Type]->Remove(Entity.Index);
+    }
+  }
+
+  template<typename C, typename ... Cs, typename F>
+  void Registry::Each(F&& Function)
+  {
+    if (!mPools[C::Type] || ((!mPools[Cs::Type]) || ...))
+    {
+      return;
+    }
+
+    ComponentPool<C>& pool = GetPool<C>();
+
+    for (U32 i = 0; i < pool.GetCount(); i++)
+    {
+      if constexpr (sizeof...(Cs) > 0)
+      {
+        U32 entityIndex = pool.GetEntityIndex(i);
+
+        std::tuple<Cs* ...> others = { GetPool<Cs>().Find(entityIndex) ... };
+
+        if ((std::get<Cs*>(others) && ...))
+        {
+          Function(pool.At(i), *std::get<Cs*>(others) ...);
+        }
+      }
+      else
+      {
+        Function(pool.At(i));
+      }
+    }
+  }
+}
\ No newline at end of file
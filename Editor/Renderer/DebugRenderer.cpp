@@ -1,4 +1,8 @@
+#include <cstring>
+#include <vector>
+
 #include <Editor/Mesh.h>
+#include <Editor/Profiler.h>
 #include <Editor/Scene.h>
 #include <Editor/Shader.h>
 #include <Editor/Vertex.h>
@@ -20,26 +24,36 @@ extern ark::Scene* gScene;
 
 namespace ark
 {
-  DebugRenderer::DebugRenderer(U32 VertexBufferSize, U32 ElementBufferSize)
-    : mVertexBuffer{ new DebugVertex[VertexBufferSize] }
-    , mElementBuffer{ new U32[ElementBufferSize] }
-    , mMesh{ new Mesh<DebugVertex, U32> }
-    , mShader{ new Shader{ fs::path{ SHADER_DIR } / "Debug.glsl" } }
+  DebugRenderer::DebugRenderer(U32 VertexBufferSize)
+    : mShader{ new Shader{ fs::path{ SHADER_DIR } / "Debug.glsl" } }
   {
+    glCreateVertexArrays(1, &mVao);
+
+    glEnableVertexArrayAttrib(mVao, 0);
+    glEnableVertexArrayAttrib(mVao, 1);
+    glVertexArrayAttribFormat(mVao, 0, 3, GL_FLOAT, GL_FALSE, 0);
+    glVertexArrayAttribFormat(mVao, 1, 4, GL_FLOAT, GL_FALSE, sizeof(R32V3));
+    glVertexArrayAttribBinding(mVao, 0, 0);
+    glVertexArrayAttribBinding(mVao, 1, 0);
 
+    CreateBuffer(VertexBufferSize);
   }
 
   DebugRenderer::~DebugRenderer()
   {
+    DestroyBuffer();
+
+    glDeleteVertexArrays(1, &mVao);
+
     delete mShader;
-    delete mMesh;
-    delete[] mElementBuffer;
-    delete[] mVertexBuffer;
   }
 
   void DebugRenderer::Render()
   {
-    if (gScene)
+    ProfilerCpuScope cpuScope{ "Debug Render" };
+    ProfilerGpuScope gpuScope{ "Debug Render" };
+
+    if (gScene && mVertexOffset)
     {
       Camera* camera = gScene->GetMainCamera();
 
@@ -50,90 +64,133 @@ namespace ark
         mShader->SetUniformR32M4("UniformProjectionMatrix", camera->GetProjectionMatrix());
         mShader->SetUniformR32M4("UniformViewMatrix", camera->GetViewMatrix());
 
-        // Clear previous entries...
-
-        mMesh->Bind();
-        mMesh->UploadVertices(mVertexBuffer, mVertexOffset);
-        mMesh->UploadElements(mElementBuffer, mElementOffset);
-        mMesh->Render(eRenderModeLines);
-        mMesh->UnBind();
+        glBindVertexArray(mVao);
+        glDrawArrays(GL_LINES, (I32)(mRegion * mVertexBufferSize), (I32)mVertexOffset);
+        glBindVertexArray(0);
 
         mShader->UnBind();
+
+        Profiler::CountDrawCalls(1);
+        Profiler::CountUploadBytes(mVertexOffset * sizeof(DebugVertex));
       }
     }
 
+    mFences[mRegion] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    mRegion = (mRegion + 1) % sRegionCount;
     mVertexOffset = 0;
-    mElementOffset = 0;
+
+    WaitRegion(mRegion);
   }
 
   void DebugRenderer::DebugLine(R32V3 P0, R32V3 P1, R32V4 C)
   {
-    gDebugRenderer->mVertexBuffer[gDebugRenderer->mVertexOffset + 0].Position = P0;
-    gDebugRenderer->mVertexBuffer[gDebugRenderer->mVertexOffset + 1].Position = P1;
-
-    gDebugRenderer->mVertexBuffer[gDebugRenderer->mVertexOffset + 0].Color = C;
-    gDebugRenderer->mVertexBuffer[gDebugRenderer->mVertexOffset + 1].Color = C;
-
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 0] = gDebugRenderer->mVertexOffset + 0;
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 1] = gDebugRenderer->mVertexOffset + 1;
+    DebugVertex* vertices = gDebugRenderer->Reserve(2);
 
-    gDebugRenderer->mVertexOffset += 2;
-    gDebugRenderer->mElementOffset += 2;
+    vertices[0] = DebugVertex{ P0, C };
+    vertices[1] = DebugVertex{ P1, C };
   }
 
   void DebugRenderer::DebugBox(R32V3 P, R32V3 S, R32V4 C, R32Q R)
   {
+    static constexpr U32 sEdges[24] =
+    {
+      0, 1, 0, 2, 2, 3, 3, 1,
+      4, 5, 4, 6, 6, 7, 7, 5,
+      0, 4, 1, 5, 2, 6, 3, 7,
+    };
+
     R32V3 h{ S / 2.0F };
 
-    gDebugRenderer->mVertexBuffer[gDebugRenderer->mVertexOffset + 0].Position = P + R * R32V3{ -h.x, -h.y, -h.z };
-    gDebugRenderer->mVertexBuffer[gDebugRenderer->mVertexOffset + 1].Position = P + R * R32V3{ h.x, -h.y, -h.z };
-    gDebugRenderer->mVertexBuffer[gDebugRenderer->mVertexOffset + 2].Position = P + R * R32V3{ -h.x, h.y, -h.z };
-    gDebugRenderer->mVertexBuffer[gDebugRenderer->mVertexOffset + 3].Position = P + R * R32V3{ h.x, h.y, -h.z };
-
-    gDebugRenderer->mVertexBuffer[gDebugRenderer->mVertexOffset + 4].Position = P + R * R32V3{ -h.x, -h.y, h.z };
-    gDebugRenderer->mVertexBuffer[gDebugRenderer->mVertexOffset + 5].Position = P + R * R32V3{ h.x, -h.y, h.z };
-    gDebugRenderer->mVertexBuffer[gDebugRenderer->mVertexOffset + 6].Position = P + R * R32V3{ -h.x, h.y, h.z };
-    gDebugRenderer->mVertexBuffer[gDebugRenderer->mVertexOffset + 7].Position = P + R * R32V3{ h.x, h.y, h.z };
-
-    gDebugRenderer->mVertexBuffer[gDebugRenderer->mVertexOffset + 0].Color = C;
-    gDebugRenderer->mVertexBuffer[gDebugRenderer->mVertexOffset + 1].Color = C;
-    gDebugRenderer->mVertexBuffer[gDebugRenderer->mVertexOffset + 2].Color = C;
-    gDebugRenderer->mVertexBuffer[gDebugRenderer->mVertexOffset + 3].Color = C;
-
-    gDebugRenderer->mVertexBuffer[gDebugRenderer->mVertexOffset + 4].Color = C;
-    gDebugRenderer->mVertexBuffer[gDebugRenderer->mVertexOffset + 5].Color = C;
-    gDebugRenderer->mVertexBuffer[gDebugRenderer->mVertexOffset + 6].Color = C;
-    gDebugRenderer->mVertexBuffer[gDebugRenderer->mVertexOffset + 7].Color = C;
-
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 0] = gDebugRenderer->mVertexOffset + 0;
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 1] = gDebugRenderer->mVertexOffset + 1;
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 2] = gDebugRenderer->mVertexOffset + 0;
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 3] = gDebugRenderer->mVertexOffset + 2;
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 4] = gDebugRenderer->mVertexOffset + 2;
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 5] = gDebugRenderer->mVertexOffset + 3;
-
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 6] = gDebugRenderer->mVertexOffset + 3;
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 7] = gDebugRenderer->mVertexOffset + 1;
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 8] = gDebugRenderer->mVertexOffset + 4;
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 9] = gDebugRenderer->mVertexOffset + 5;
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 10] = gDebugRenderer->mVertexOffset + 4;
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 11] = gDebugRenderer->mVertexOffset + 6;
-
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 12] = gDebugRenderer->mVertexOffset + 6;
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 13] = gDebugRenderer->mVertexOffset + 7;
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 14] = gDebugRenderer->mVertexOffset + 7;
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 15] = gDebugRenderer->mVertexOffset + 5;
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 16] = gDebugRenderer->mVertexOffset + 0;
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 17] = gDebugRenderer->mVertexOffset + 4;
-
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 18] = gDebugRenderer->mVertexOffset + 1;
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 19] = gDebugRenderer->mVertexOffset + 5;
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 20] = gDebugRenderer->mVertexOffset + 2;
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 21] = gDebugRenderer->mVertexOffset + 6;
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 22] = gDebugRenderer->mVertexOffset + 3;
-    gDebugRenderer->mElementBuffer[gDebugRenderer->mElementOffset + 23] = gDebugRenderer->mVertexOffset + 7;
-
-    gDebugRenderer->mVertexOffset += 8;
-    gDebugRenderer->mElementOffset += 24;
+    R32V3 corners[8] =
+    {
+      P + R * R32V3{ -h.x, -h.y, -h.z },
+      P + R * R32V3{ h.x, -h.y, -h.z },
+      P + R * R32V3{ -h.x, h.y, -h.z },
+      P + R * R32V3{ h.x, h.y, -h.z },
+      P + R * R32V3{ -h.x, -h.y, h.z },
+      P + R * R32V3{ h.x, -h.y, h.z },
+      P + R * R32V3{ -h.x, h.y, h.z },
+      P + R * R32V3{ h.x, h.y, h.z },
+    };
+
+    DebugVertex* vertices = gDebugRenderer->Reserve(24);
+
+    for (U32 i = 0; i < 24; i++)
+    {
+      vertices[i] = DebugVertex{ corners[sEdges[i]], C };
+    }
+  }
+
+  DebugVertex* DebugRenderer::Reserve(U32 VertexCount)
+  {
+    if ((mVertexOffset + VertexCount) > mVertexBufferSize)
+    {
+      U32 vertexBufferSize = mVertexBufferSize * 2;
+
+      while ((mVertexOffset + VertexCount) > vertexBufferSize)
+      {
+        vertexBufferSize *= 2;
+      }
+
+      // Carry over what has been written this frame, reading back from mapped memory is slow but growing is rare
+
+      std::vector<DebugVertex> vertices = std::vector<DebugVertex>(mVertexOffset);
+
+      std::memcpy(vertices.data(), mMappedBuffer + mRegion * mVertexBufferSize, mVertexOffset * sizeof(DebugVertex));
+
+      DestroyBuffer();
+      CreateBuffer(vertexBufferSize);
+
+      std::memcpy(mMappedBuffer, vertices.data(), mVertexOffset * sizeof(DebugVertex));
+    }
+
+    DebugVertex* vertices = mMappedBuffer + mRegion * mVertexBufferSize + mVertexOffset;
+
+    mVertexOffset += VertexCount;
+
+    return vertices;
+  }
+
+  void DebugRenderer::CreateBuffer(U32 VertexBufferSize)
+  {
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    GLsizeiptr size = (GLsizeiptr)VertexBufferSize * sRegionCount * sizeof(DebugVertex);
+
+    glCreateBuffers(1, &mVbo);
+    glNamedBufferStorage(mVbo, size, nullptr, flags);
+
+    mMappedBuffer = (DebugVertex*)glMapNamedBufferRange(mVbo, 0, size, flags);
+
+    glVertexArrayVertexBuffer(mVao, 0, mVbo, 0, sizeof(DebugVertex));
+
+    mVertexBufferSize = VertexBufferSize;
+    mRegion = 0;
+  }
+
+  void DebugRenderer::DestroyBuffer()
+  {
+    for (U32 i = 0; i < sRegionCount; i++)
+    {
+      WaitRegion(i);
+    }
+
+    glUnmapNamedBuffer(mVbo);
+    glDeleteBuffers(1, &mVbo);
+
+    mMappedBuffer = nullptr;
+    mVbo = 0;
+  }
+
+  void DebugRenderer::WaitRegion(U32 Region)
+  {
+    if (mFences[Region])
+    {
+      while (glClientWaitSync(mFences[Region], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000) == GL_TIMEOUT_EXPIRED);
+
+      glDeleteSync(mFences[Region]);
+
+      mFences[Region] = nullptr;
+    }
   }
 }
\ No newline at end of file
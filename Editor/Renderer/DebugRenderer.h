@@ -6,6 +6,8 @@
 
 #include <Editor/Forward.h>
 
+#include <Vendor/GLAD/glad.h>
+
 ///////////////////////////////////////////////////////////
 // Namespaces
 ///////////////////////////////////////////////////////////
@@ -18,11 +20,23 @@ namespace fs = std::filesystem;
 
 namespace ark
 {
+  /*
+   * Immediate mode line renderer.
+   *
+   * Lines are written straight into a persistently mapped vertex buffer which is
+   * split into one region per frame in flight. Each region is guarded by a fence,
+   * so the CPU never writes into memory the GPU is still reading from. Running
+   * out of space doubles the capacity of every region.
+   */
   class DebugRenderer
   {
   public:
 
-    DebugRenderer(U32 VertexBufferSize, U32 ElementBufferSize);
+    static constexpr U32 sRegionCount = 3;
+
+  public:
+
+    DebugRenderer(U32 VertexBufferSize);
     virtual ~DebugRenderer();
 
   public:
@@ -36,12 +50,24 @@ namespace ark
 
   private:
 
-    DebugVertex* mVertexBuffer;
-    U32* mElementBuffer;
-    Mesh<DebugVertex, U32>* mMesh;
+    DebugVertex* Reserve(U32 VertexCount);
+
+    void CreateBuffer(U32 VertexBufferSize);
+    void DestroyBuffer();
+    void WaitRegion(U32 Region);
+
+  private:
+
+    U32 mVao = 0;
+    U32 mVbo = 0;
+
+    DebugVertex* mMappedBuffer = nullptr;
+    GLsync mFences[sRegionCount] = {};
+
     Shader* mShader;
 
+    U32 mVertexBufferSize = 0;
     U32 mVertexOffset = 0;
-    U32 mElementOffset = 0;
+    U32 mRegion = 0;
   };
 }
\ No newline at end of file
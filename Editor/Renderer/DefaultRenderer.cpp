@@ -1,6 +1,12 @@
+#include <algorithm>
+
 #include <Editor/Mesh.h>
+#include <Editor/Profiler.h>
 #include <Editor/Scene.h>
 #include <Editor/Shader.h>
+#include <Editor/Texture.h>
+#include <Editor/TextureArray.h>
+#include <Editor/TextureCache.h>
 #include <Editor/Vertex.h>
 
 #include <Editor/Components/Camera.h>
@@ -15,6 +21,18 @@
 extern ark::DefaultRenderer* gDefaultRenderer;
 extern ark::Scene* gScene;
 
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static const TextureArray* GetResidentArray(const RenderTask& RenderTask)
+  {
+    return (RenderTask.TexturePtr && RenderTask.TexturePtr->IsResident()) ? RenderTask.TexturePtr->GetArray() : nullptr;
+  }
+}
+
 ///////////////////////////////////////////////////////////
 // Implementation
 ///////////////////////////////////////////////////////////
@@ -24,49 +42,194 @@ namespace ark
   DefaultRenderer::DefaultRenderer()
     : mShader{ new Shader{ fs::path{ SHADER_DIR } / "Default.glsl" } }
   {
-
+    glCreateBuffers(1, &mInstanceBuffer);
+    glCreateBuffers(1, &mMaterialBuffer);
   }
 
   DefaultRenderer::~DefaultRenderer()
   {
+    glDeleteBuffers(1, &mMaterialBuffer);
+    glDeleteBuffers(1, &mInstanceBuffer);
+
     delete mShader;
   }
 
   void DefaultRenderer::AddRenderTask(const RenderTask& RenderTask)
   {
-    gDefaultRenderer->mRenderQueue.emplace(RenderTask);
+    if (RenderTask.TransformPtr && RenderTask.MeshPtr)
+    {
+      gDefaultRenderer->mRenderQueue.Push(RenderTask);
+    }
   }
 
   void DefaultRenderer::Render()
   {
-    while (!mRenderQueue.empty())
+    ProfilerCpuScope cpuScope{ "Default Render" };
+    ProfilerGpuScope gpuScope{ "Default Render" };
+
+    Camera* camera = gScene ? gScene->GetMainCamera() : nullptr;
+
+    if (camera && mRenderQueue.GetCount())
     {
-      RenderTask& renderTask = mRenderQueue.front();
+      R32M4 viewMatrix = camera->GetViewMatrix();
 
-      if (renderTask.TransformPtr && renderTask.MeshPtr)
       {
-        if (gScene)
+        ProfilerCpuScope scope{ "Sort" };
+
+        mRenderQueue.Sort([&](const RenderTask& RenderTask)
         {
-          Camera* camera = gScene->GetMainCamera();
+          const TextureArray* array = GetResidentArray(RenderTask);
 
-          if (camera)
-          {
-            mShader->Bind();
+          R32 depth = -(viewMatrix * R32V4{ R32V3{ RenderTask.TransformPtr->GetModelMatrix()[3] }, 1.0F }).z;
+
+          return RenderQueue::MakeKey(RenderTask.Pass, 0, array ? array->GetId() : 0, RenderTask.MeshPtr->GetVao(), depth);
+        });
+      }
+
+      mInstances.clear();
+      mMaterials.clear();
+
+      Texture* touchedTexture = nullptr;
+
+      for (U32 i = 0; i < mRenderQueue.GetCount(); i++)
+      {
+        const RenderTask& renderTask = mRenderQueue.GetTask(i);
+
+        Texture* texture = renderTask.TexturePtr;
+
+        if (texture && texture != touchedTexture)
+        {
+          gScene->GetTextureCache().Touch(texture);
+
+          touchedTexture = texture;
+        }
+
+        U32 textured = texture && texture->IsResident();
+
+        mInstances.emplace_back(renderTask.TransformPtr->GetModelMatrix());
+        mMaterials.emplace_back(RenderMaterial{ textured ? texture->GetLayer() : 0, textured ? (R32)texture->GetResidentMip() : 0.0F, textured, 0 });
+      }
+
+      U32 instanceBufferSize = (U32)(mInstances.size() * sizeof(R32M4));
+      U32 materialBufferSize = (U32)(mMaterials.size() * sizeof(RenderMaterial));
+
+      if (instanceBufferSize > mInstanceBufferSize)
+      {
+        mInstanceBufferSize = std::max(instanceBufferSize, mInstanceBufferSize * 2);
+
+        glNamedBufferData(mInstanceBuffer, mInstanceBufferSize, nullptr, GL_DYNAMIC_DRAW);
+      }
+
+      if (materialBufferSize > mMaterialBufferSize)
+      {
+        mMaterialBufferSize = std::max(materialBufferSize, mMaterialBufferSize * 2);
+
+        glNamedBufferData(mMaterialBuffer, mMaterialBufferSize, nullptr, GL_DYNAMIC_DRAW);
+      }
+
+      glNamedBufferSubData(mInstanceBuffer, 0, instanceBufferSize, &mInstances[0]);
+      glNamedBufferSubData(mMaterialBuffer, 0, materialBufferSize, &mMaterials[0]);
 
-            mShader->SetUniformR32M4("UniformProjectionMatrix", camera->GetProjectionMatrix());
-            mShader->SetUniformR32M4("UniformViewMatrix", camera->GetViewMatrix());
-            mShader->SetUniformR32M4("UniformModelMatrix", renderTask.TransformPtr->GetModelMatrix());
+      glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, mInstanceBuffer);
+      glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, mMaterialBuffer);
 
-            renderTask.MeshPtr->Bind();
-            renderTask.MeshPtr->Render(eRenderModeTriangles);
-            renderTask.MeshPtr->UnBind();
+      Profiler::CountUploadBytes(instanceBufferSize + materialBufferSize);
 
-            mShader->UnBind();
+      mShader->Bind();
+
+      mShader->SetUniformR32M4("UniformProjectionMatrix", camera->GetProjectionMatrix());
+      mShader->SetUniformR32M4("UniformViewMatrix", viewMatrix);
+
+      U32 instanceOffset = 0;
+      U32 instanceCount = mRenderQueue.GetCount();
+
+      const TextureArray* boundArray = nullptr;
+      RenderPass boundPass = mRenderQueue.GetTask(0).Pass;
+
+      glBindTextureUnit(0, 0);
+
+      BeginPass(boundPass);
+
+      while (instanceOffset < instanceCount)
+      {
+        const RenderTask& renderTask = mRenderQueue.GetTask(instanceOffset);
+        const TextureArray* array = GetResidentArray(renderTask);
+
+        U32 runSize = 1;
+
+        // Transparent tasks must keep their back to front order, they only get merged while adjacent
+
+        while ((instanceOffset + runSize) < instanceCount)
+        {
+          const RenderTask& nextRenderTask = mRenderQueue.GetTask(instanceOffset + runSize);
+
+          if (nextRenderTask.Pass != renderTask.Pass || nextRenderTask.MeshPtr != renderTask.MeshPtr || GetResidentArray(nextRenderTask) != array)
+          {
+            break;
           }
+
+          runSize++;
+        }
+
+        if (renderTask.Pass != boundPass)
+        {
+          EndPass(boundPass);
+          BeginPass(renderTask.Pass);
+
+          boundPass = renderTask.Pass;
         }
+
+        if (array && array != boundArray)
+        {
+          glBindTextureUnit(0, array->GetId());
+
+          boundArray = array;
+        }
+
+        mShader->SetUniformU32("UniformInstanceOffset", instanceOffset);
+
+        renderTask.MeshPtr->Bind();
+        renderTask.MeshPtr->RenderInstanced(eRenderModeTriangleStrip, runSize);
+        renderTask.MeshPtr->UnBind();
+
+        Profiler::CountDrawCalls(1);
+
+        instanceOffset += runSize;
       }
 
-      mRenderQueue.pop();
+      EndPass(boundPass);
+
+      mShader->UnBind();
+
+      glBindTextureUnit(0, 0);
+      glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, 0);
+      glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, 0);
+    }
+
+    mRenderQueue.Clear();
+  }
+
+  void DefaultRenderer::BeginPass(RenderPass Pass)
+  {
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GL_LEQUAL);
+
+    if (Pass == eRenderPassTransparent)
+    {
+      glEnable(GL_BLEND);
+      glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+      glDepthMask(GL_FALSE);
+    }
+  }
+
+  void DefaultRenderer::EndPass(RenderPass Pass)
+  {
+    if (Pass == eRenderPassTransparent)
+    {
+      glDepthMask(GL_TRUE);
+      glDisable(GL_BLEND);
     }
+
+    glDisable(GL_DEPTH_TEST);
   }
 }
\ No newline at end of file
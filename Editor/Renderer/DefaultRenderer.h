@@ -1,12 +1,14 @@
 #pragma once
 
-#include <queue>
+#include <vector>
 #include <filesystem>
 
 #include <Common/Types.h>
 
 #include <Editor/Forward.h>
 
+#include <Editor/Renderer/RenderQueue.h>
+
 ///////////////////////////////////////////////////////////
 // Namespaces
 ///////////////////////////////////////////////////////////
@@ -19,12 +21,22 @@ namespace fs = std::filesystem;
 
 namespace ark
 {
-  struct RenderTask
+  struct RenderMaterial
   {
-    const Transform* TransformPtr;
-    const Mesh<DefaultVertex, U32>* MeshPtr;
+    U32 Layer;
+    R32 MinLod;
+    U32 Textured;
+    U32 Reserved;
   };
 
+  /*
+   * Draws all render tasks of a frame in sort key order.
+   *
+   * Model matrices and texture layers of every task are written into storage
+   * buffers, each run of tasks sharing pass, texture array and mesh is issued as
+   * a single instanced draw call. Opaque tasks are drawn first with depth writes,
+   * transparent ones afterwards blended on top.
+   */
   class DefaultRenderer
   {
   public:
@@ -40,10 +52,23 @@ namespace ark
 
     void Render();
 
+  private:
+
+    void BeginPass(RenderPass Pass);
+    void EndPass(RenderPass Pass);
+
   private:
 
     Shader* mShader;
 
-    std::queue<RenderTask> mRenderQueue = {};
+    U32 mInstanceBuffer = 0;
+    U32 mInstanceBufferSize = 0;
+
+    U32 mMaterialBuffer = 0;
+    U32 mMaterialBufferSize = 0;
+
+    RenderQueue mRenderQueue = {};
+    std::vector<R32M4> mInstances = {};
+    std::vector<RenderMaterial> mMaterials = {};
   };
 }
\ No newline at end of file
@@ -0,0 +1,116 @@
+#include <bit>
+#include <algorithm>
+
+#include <Editor/Renderer/RenderQueue.h>
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static constexpr U32 sPassBits = 2;
+  static constexpr U32 sShaderBits = 6;
+  static constexpr U32 sTextureBits = 12;
+  static constexpr U32 sMeshBits = 12;
+  static constexpr U32 sDepthBits = 32;
+
+  static constexpr U32 sMeshShift = sDepthBits;
+  static constexpr U32 sTextureShift = sMeshShift + sMeshBits;
+  static constexpr U32 sShaderShift = sTextureShift + sTextureBits;
+  static constexpr U32 sPassShift = sShaderShift + sShaderBits;
+
+  static_assert((sPassShift + sPassBits) == 64);
+}
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  U64 RenderQueue::MakeKey(RenderPass Pass, U32 Shader, U32 Texture, U32 Mesh, R32 Depth)
+  {
+    // Positive floats keep their order when compared as integers
+
+    U32 depth = std::bit_cast<U32>(std::max(Depth, 0.0F));
+
+    if (Pass == eRenderPassTransparent)
+    {
+      depth = ~depth;
+    }
+
+    U64 key = 0;
+
+    key |= ((U64)Pass & ((1ULL << sPassBits) - 1)) << sPassShift;
+    key |= ((U64)Shader & ((1ULL << sShaderBits) - 1)) << sShaderShift;
+    key |= ((U64)Texture & ((1ULL << sTextureBits) - 1)) << sTextureShift;
+    key |= ((U64)Mesh & ((1ULL << sMeshBits) - 1)) << sMeshShift;
+    key |= (U64)depth;
+
+    return key;
+  }
+
+  void RenderQueue::Clear()
+  {
+    mTasks.clear();
+    mKeys.clear();
+    mIndices.clear();
+  }
+
+  void RenderQueue::RadixSort()
+  {
+    U32 count = (U32)mKeys.size();
+
+    if (count == 0)
+    {
+      return;
+    }
+
+    mScratchKeys.resize(count);
+    mScratchIndices.resize(count);
+
+    U32 histograms[sizeof(U64)][256] = {};
+
+    for (U64 key : mKeys)
+    {
+      for (U32 i = 0; i < sizeof(U64); i++)
+      {
+        histograms[i][(key >> (i * 8)) & 0xFF]++;
+      }
+    }
+
+    for (U32 i = 0; i < sizeof(U64); i++)
+    {
+      U32* histogram = histograms[i];
+
+      // All keys share this byte, the pass would not move anything
+
+      if (histogram[(mKeys[0] >> (i * 8)) & 0xFF] == count)
+      {
+        continue;
+      }
+
+      U32 offset = 0;
+
+      for (U32 j = 0; j < 256; j++)
+      {
+        U32 size = histogram[j];
+
+        histogram[j] = offset;
+        offset += size;
+      }
+
+      for (U32 j = 0; j < count; j++)
+      {
+        U32 destination = histogram[(mKeys[j] >> (i * 8)) & 0xFF]++;
+
+        mScratchKeys[destination] = mKeys[j];
+        mScratchIndices[destination] = mIndices[j];
+      }
+
+      mKeys.swap(mScratchKeys);
+      mIndices.swap(mScratchIndices);
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <vector>
+
+#include <Common/Types.h>
+
+#include <Editor/Forward.h>
+
+///////////////////////////////////////////////////////////
+// Definition
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  enum RenderPass
+  {
+    eRenderPassOpaque = 0,
+    eRenderPassTransparent = 1,
+  };
+
+  struct RenderTask
+  {
+    const Transform* TransformPtr;
+    const Mesh<DefaultVertex, U16>* MeshPtr;
+    Texture* TexturePtr;
+    RenderPass Pass = eRenderPassOpaque;
+  };
+
+  /*
+   * Flat list of render tasks ordered by 64 bit sort keys.
+   *
+   * From most to least significant bit a key holds the pass, shader, texture, mesh
+   * and view depth, so sorting groups tasks by the state they require and orders
+   * opaque tasks front to back and transparent ones back to front. Keys are sorted
+   * with a byte wise radix sort, skipping bytes all keys agree on. Clearing keeps
+   * the storage around for the next frame.
+   */
+  class RenderQueue
+  {
+  public:
+
+    static U64 MakeKey(RenderPass Pass, U32 Shader, U32 Texture, U32 Mesh, R32 Depth);
+
+  public:
+
+    inline auto GetCount() const { return (U32)mTasks.size(); }
+    inline auto GetKey(U32 Index) const { return mKeys[Index]; }
+
+    inline const auto& GetTask(U32 Index) const { return mTasks[mIndices[Index]]; }
+
+  public:
+
+    inline void Push(const RenderTask& RenderTask) { mTasks.emplace_back(RenderTask); }
+
+    template<typename F>
+    void Sort(F&& MakeKey);
+
+    void Clear();
+
+  private:
+
+    void RadixSort();
+
+  private:
+
+    std::vector<RenderTask> mTasks = {};
+
+    std::vector<U64> mKeys = {};
+    std::vector<U32> mIndices = {};
+
+    std::vector<U64> mScratchKeys = {};
+    std::vector<U32> mScratchIndices = {};
+  };
+}
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  template<typename F>
+  void RenderQueue::Sort(F&& MakeKey)
+  {
+    U32 count = (U32)mTasks.size();
+
+    mKeys.resize(count);
+    mIndices.resize(count);
+
+    for (U32 i = 0; i < count; i++)
+    {
+      mKeys[i] = MakeKey(mTasks[i]);
+      mIndices[i] = i;
+    }
+
+    RadixSort();
+  }
+}
\ No newline at end of file
@@ -1,3 +1,14 @@
+#include <algorithm>
+#include <cstring>
+#include <set>
+
+#include <Common/Crc32.h>
+#include <Common/Debug.h>
+#include <Common/JobSystem.h>
+#include <Common/Packer.h>
+#include <Common/VirtualFileSystem.h>
+
+#include <Editor/Mesh.h>
 #include <Editor/Scene.h>
 
 #include <Editor/Actors/Player.h>
@@ -9,6 +20,7 @@
 #include <Editor/Components/Transform.h>
 #include <Editor/Components/Renderable.h>
 
+#include <Editor/Serializer/LevelCacheSerializer.h>
 #include <Editor/Serializer/ModelSerializer.h>
 #include <Editor/Serializer/ObjectSerializer.h>
 
@@ -19,6 +31,33 @@
 ///////////////////////////////////////////////////////////
 
 extern rj::Document gConfig;
+extern rj::Document gPacker;
+
+extern ark::VirtualFileSystem gFileSystem;
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static U64 ConfigMegaBytes(const char* Name, U64 Default)
+  {
+    U64 megaBytes = (gConfig.HasMember(Name) && gConfig[Name].IsUint()) ? gConfig[Name].GetUint() : Default;
+
+    return megaBytes * 1024ULL * 1024ULL;
+  }
+
+  static U32 ConfigModelFlags()
+  {
+    return (gConfig.HasMember("optimizeMeshes") && gConfig["optimizeMeshes"].GetBool()) ? 1 : 0;
+  }
+
+  static U32 IsObjectFile(const fs::path& File)
+  {
+    return File.extension() == ".TSC" || File.extension() == ".TRE" || File.extension() == ".TAT";
+  }
+}
 
 ///////////////////////////////////////////////////////////
 // Implementation
@@ -29,6 +68,7 @@ namespace ark
   Scene::Scene(const std::string& RegionId, const std::string& LevelId)
     : mRegionId{ RegionId }
     , mLevelId{ LevelId }
+    , mTextureCache{ ConfigMegaBytes("textureBudget", 512), ConfigMegaBytes("textureUploadBudget", 8) }
   {
     DeSerialize();
 
@@ -45,40 +85,52 @@ namespace ark
 
     for (const auto& modelGroup : mModelGroups)
     {
-      Actor* groupActor = CreateActor<Actor>(modelGroup.GetName(), nullptr);
-
-      for (const auto& modelEntry : modelGroup)
-      {
-        Actor* entryActor = CreateActor<Actor>(std::to_string(modelEntry.GetId()), groupActor);
-        Transform* entryTransform = entryActor->GetTransform();
-
-        entryTransform->SetWorldPosition(modelEntry.GetPosition());
-        entryTransform->SetWorldRotation(modelEntry.GetRotation());
-        entryTransform->SetWorldScale(modelEntry.GetScale());
-
-        for (const auto& modelDivision : modelEntry)
-        {
-          Actor* divisionActor = CreateActor<Actor>("Division", entryActor);
-          Renderable* divisionRenderable = divisionActor->AttachComponent<Renderable>();
-
-          divisionRenderable->SetVertexBuffer(modelDivision.GetVertexBuffer());
-          divisionRenderable->SetElementBuffer(modelDivision.GetElementBuffer());
-        }
-      }
+      CreateModelGroupActor(modelGroup);
     }
+
+    mFileWatcher = new FileWatcher{ fs::path{ gConfig["unpackDir"].GetString() } / "levels" / mRegionId / mLevelId };
   }
 
   Scene::~Scene()
   {
     Serialize();
 
+    delete mFileWatcher;
+    mFileWatcher = nullptr;
+
+    // Memory goes back with the arena, only destructors need to run
+
     for (auto& actor : mActors)
     {
-      delete actor;
+      actor->~Actor();
       actor = nullptr;
     }
 
     mActors.clear();
+    mActorSlots.clear();
+
+    for (auto& [key, mesh] : mMeshes)
+    {
+      delete mesh.Instance;
+      mesh.Instance = nullptr;
+    }
+
+    mMeshes.clear();
+  }
+
+  Actor* Scene::GetActor(Entity Entity) const
+  {
+    if (Entity.Index < mActorSlots.size())
+    {
+      Actor* actor = mActorSlots[Entity.Index].Instance;
+
+      if (actor && actor->GetEntity() == Entity)
+      {
+        return actor;
+      }
+    }
+
+    return nullptr;
   }
 
   Actor* Scene::GetMainActor()
@@ -96,21 +148,77 @@ namespace ark
     return nullptr;
   }
 
-  void Scene::DestroyActor(Actor* Actor)
+  void Scene::DestroyActor(Entity Entity)
   {
-    auto actorIt = std::find(mActors.begin(), mActors.end(), Actor);
+    Actor* actor = GetActor(Entity);
+
+    if (!actor)
+    {
+      return;
+    }
+
+    while (actor->HasChildren())
+    {
+      DestroyActor(actor->GetChildren().back()->GetEntity());
+    }
+
+    if (actor->GetParent())
+    {
+      actor->GetParent()->RemoveChild(actor);
+    }
+
+    if (actor == mMainActor)
+    {
+      mMainActor = nullptr;
+    }
+
+    ActorSlot slot = mActorSlots[Entity.Index];
+
+    Actor* last = mActors.back();
+
+    mActors[slot.Index] = last;
+    mActorSlots[last->GetEntity().Index].Index = slot.Index;
+    mActors.pop_back();
+
+    mActorSlots[Entity.Index] = {};
 
-    if (actorIt != mActors.end())
+    actor->~Actor();
+
+    mActorPool.deallocate(actor, slot.Size, alignof(std::max_align_t));
+
+    mRevision++;
+  }
+
+  void Scene::DestroyActor(Actor* Actor)
+  {
+    if (Actor)
     {
-      delete *actorIt;
-      *actorIt = nullptr;
+      DestroyActor(Actor->GetEntity());
+    }
+  }
 
-      mActors.erase(actorIt);
+  void Scene::RegisterActor(Actor* Actor, U32 Size)
+  {
+    U32 entityIndex = Actor->GetEntity().Index;
+
+    if (entityIndex >= mActorSlots.size())
+    {
+      mActorSlots.resize(entityIndex + 1);
     }
+
+    mActorSlots[entityIndex] = ActorSlot{ Actor, Size, (U32)mActors.size() };
+
+    mActors.emplace_back(Actor);
+
+    mRevision++;
   }
 
   void Scene::Update(R32 TimeDelta)
   {
+    Reload();
+
+    mTextureCache.Update();
+
     DebugRenderer::DebugLine(R32V3{ -10000.0F, 0.0F, 0.0F }, R32V3{ 10000.0F, 0.0F, 0.0F }, R32V4{ 1.0F, 0.0F, 0.0F, 1.0F });
     DebugRenderer::DebugLine(R32V3{ 0.0F, -10000.0F, 0.0F }, R32V3{ 0.0F, 10000.0F, 0.0F }, R32V4{ 0.0F, 1.0F, 0.0F, 1.0F });
     DebugRenderer::DebugLine(R32V3{ 0.0F, 0.0F, -10000.0F }, R32V3{ 0.0F, 0.0F, 10000.0F }, R32V4{ 0.0F, 0.0F, 1.0F, 1.0F });
@@ -118,33 +226,277 @@ namespace ark
     for (const auto& actor : mActors)
     {
       actor->Update(TimeDelta);
+    }
 
-      Transform* transform = actor->GetTransform();
-      Renderable* renderable = actor->GetComponent<Renderable>();
+    mHierarchy.Update();
 
-      if (transform && renderable)
-      {
-        DefaultRenderer::AddRenderTask(RenderTask{ transform, renderable->GetMeshPtr() });
-      }
+    mRegistry.Each<Renderable, Transform>([](Renderable& Renderable, Transform& Transform)
+    {
+      DefaultRenderer::AddRenderTask(RenderTask{ &Transform, Renderable.GetMeshPtr(), Renderable.GetTexturePtr() });
+    });
+
+    mRegistry.Each<Transform>([this](Transform& Transform)
+    {
+      Actor* actor = Transform.GetActor();
 
       if (actor != mMainActor)
       {
-        DebugRenderer::DebugLine(transform->GetWorldPosition(), transform->GetWorldPosition() + transform->GetWorldRight(), R32V4{ 1.0F, 0.0F, 0.0F, 1.0F });
-        DebugRenderer::DebugLine(transform->GetWorldPosition(), transform->GetWorldPosition() + transform->GetWorldUp(), R32V4{ 0.0F, 1.0F, 0.0F, 1.0F });
-        DebugRenderer::DebugLine(transform->GetWorldPosition(), transform->GetWorldPosition() + transform->GetWorldFront(), R32V4{ 0.0F, 0.0F, 1.0F, 1.0F });
+        R32V3 worldPosition = Transform.GetWorldPosition();
 
-        DebugRenderer::DebugLine(transform->GetWorldPosition(), transform->GetWorldPosition() + transform->GetLocalRight(), R32V4{ 1.0F, 0.0F, 0.0F, 1.0F });
-        DebugRenderer::DebugLine(transform->GetWorldPosition(), transform->GetWorldPosition() + transform->GetLocalUp(), R32V4{ 0.0F, 1.0F, 0.0F, 1.0F });
-        DebugRenderer::DebugLine(transform->GetWorldPosition(), transform->GetWorldPosition() + transform->GetLocalFront(), R32V4{ 0.0F, 0.0F, 1.0F, 1.0F });
+        DebugRenderer::DebugLine(worldPosition, worldPosition + Transform.GetWorldRight(), R32V4{ 1.0F, 0.0F, 0.0F, 1.0F });
+        DebugRenderer::DebugLine(worldPosition, worldPosition + Transform.GetWorldUp(), R32V4{ 0.0F, 1.0F, 0.0F, 1.0F });
+        DebugRenderer::DebugLine(worldPosition, worldPosition + Transform.GetWorldFront(), R32V4{ 0.0F, 0.0F, 1.0F, 1.0F });
+
+        DebugRenderer::DebugLine(worldPosition, worldPosition + Transform.GetLocalRight(), R32V4{ 1.0F, 0.0F, 0.0F, 1.0F });
+        DebugRenderer::DebugLine(worldPosition, worldPosition + Transform.GetLocalUp(), R32V4{ 0.0F, 1.0F, 0.0F, 1.0F });
+        DebugRenderer::DebugLine(worldPosition, worldPosition + Transform.GetLocalFront(), R32V4{ 0.0F, 0.0F, 1.0F, 1.0F });
 
         if (actor->GetParent())
         {
-          DebugRenderer::DebugLine(transform->GetWorldPosition(), transform->GetWorldPosition(), R32V4{ 1.0F, 1.0F, 1.0F, 1.0F });
+          DebugRenderer::DebugLine(worldPosition, worldPosition, R32V4{ 1.0F, 1.0F, 1.0F, 1.0F });
+        }
+
+        //DebugRenderer::DebugBox(worldPosition, Transform.GetWorldScale(), R32V4{ 1.0F, 1.0F, 0.0F, 1.0F }, Transform.GetQuaternion());
+      }
+    });
+  }
+
+  void Scene::Reload()
+  {
+    U32 objectsChanged = 0;
+
+    for (const auto& event : mFileWatcher->Poll())
+    {
+      if (event.Type == eFileEventOverflow)
+      {
+        LOG_WARNING("Missed changes of level %s/%s, reload it to pick them up\n", mRegionId.c_str(), mLevelId.c_str());
+
+        continue;
+      }
+
+      if (event.File.extension() == ".SCR")
+      {
+        ReloadModelGroup(event.File);
+      }
+
+      if (IsObjectFile(event.File))
+      {
+        objectsChanged = 1;
+      }
+    }
+
+    if (objectsChanged)
+    {
+      ReloadObjects();
+    }
+  }
+
+  void Scene::ReloadModelGroup(const fs::path& File)
+  {
+    std::string name = File.stem().string();
+
+    // Only the actors of this group are rebuilt, meshes shared with other groups survive
+
+    auto actorIt = mModelGroupActors.find(name);
+
+    if (actorIt != mModelGroupActors.end())
+    {
+      DestroyActor(actorIt->second);
+
+      mModelGroupActors.erase(actorIt);
+    }
+
+    auto groupIt = std::find_if(mModelGroups.begin(), mModelGroups.end(), [&](const ModelGroup& Group) { return Group.GetName() == name; });
+
+    if (groupIt != mModelGroups.end())
+    {
+      // Meshes still drawn by other groups stay alive, but can no longer be compared against the old divisions
+
+      std::set<const ModelDivision*> divisions = {};
+
+      for (const auto& modelEntry : *groupIt)
+      {
+        for (const auto& modelDivision : modelEntry)
+        {
+          divisions.emplace(&modelDivision);
         }
+      }
+
+      for (auto& [key, mesh] : mMeshes)
+      {
+        if (divisions.contains(mesh.Source))
+        {
+          mesh.Source = nullptr;
+        }
+      }
+
+      mModelGroups.erase(groupIt);
+
+      mRevision++;
+    }
+
+    // Groups loaded with the level stay in the scene arena, every reload replaces the arena of the previous one
+
+    mModelGroupArenas.erase(name);
+
+    std::vector<U8> bytes = gFileSystem.ReadBinary(fs::path{ "levels" } / mRegionId / mLevelId / File.filename());
+
+    if (!bytes.empty())
+    {
+      auto& arena = mModelGroupArenas[name] = std::make_unique<std::pmr::monotonic_buffer_resource>();
+
+      ModelSerializer modelSerializer = { arena.get(), name, bytes, ConfigModelFlags() };
+
+      AddModelGroup(std::move(modelSerializer.GetModelGroup()));
+
+      CreateModelGroupActor(mModelGroups.back());
+    }
+
+    ReleaseUnusedMeshes();
+
+    LOG_INFO("Reloaded %s\n", File.filename().string().c_str());
+  }
+
+  void Scene::ReloadObjects()
+  {
+    fs::path levelDir = fs::path{ "levels" } / mRegionId / mLevelId;
+
+    // Object tables are tiny and their objects are spread over all of them, they are read again together
+
+    mObjects.clear();
+
+    mRevision++;
+
+    for (const auto& name : gFileSystem.List(levelDir))
+    {
+      if (IsObjectFile(name))
+      {
+        std::vector<U8> bytes = gFileSystem.ReadBinary(levelDir / name);
+
+        ObjectSerializer objectSerializer = { bytes };
+
+        for (const auto& object : objectSerializer.GetObjects())
+        {
+          AddObject(object);
+        }
+      }
+    }
+
+    LOG_INFO("Reloaded %llu objects\n", (unsigned long long)mObjects.size());
+  }
+
+  Actor* Scene::CreateModelGroupActor(const ModelGroup& ModelGroup)
+  {
+    Actor* groupActor = CreateActor<Actor>(ModelGroup.GetName(), nullptr);
+
+    for (const auto& modelEntry : ModelGroup)
+    {
+      Actor* entryActor = CreateActor<Actor>(std::to_string(modelEntry.GetId()), groupActor);
+      Transform* entryTransform = entryActor->GetTransform();
+
+      entryTransform->SetWorldPosition(modelEntry.GetPosition());
+      entryTransform->SetWorldRotation(modelEntry.GetRotation());
+      entryTransform->SetWorldScale(modelEntry.GetScale());
+
+      for (const auto& modelDivision : modelEntry)
+      {
+        Actor* divisionActor = CreateActor<Actor>("Division", entryActor);
+        Renderable* divisionRenderable = divisionActor->AttachComponent<Renderable>();
+
+        divisionRenderable->SetMesh(GetOrCreateMesh(modelDivision));
+        divisionRenderable->SetTexture(AcquireTexture(ModelGroup.GetName(), modelDivision.GetTextureIndex()));
+      }
+    }
+
+    mModelGroupActors[ModelGroup.GetName()] = groupActor->GetEntity();
+
+    return groupActor;
+  }
+
+  void Scene::ReleaseUnusedMeshes()
+  {
+    std::set<const Mesh<DefaultVertex, U16>*> meshes = {};
+
+    mRegistry.Each<Renderable>([&](Renderable& Renderable)
+    {
+      meshes.emplace(Renderable.GetMeshPtr());
+    });
+
+    for (auto it = mMeshes.begin(); it != mMeshes.end();)
+    {
+      if (meshes.contains(it->second.Instance))
+      {
+        it++;
+      }
+      else
+      {
+        delete it->second.Instance;
+
+        it = mMeshes.erase(it);
+      }
+    }
+  }
+
+  const Mesh<DefaultVertex, U16>* Scene::GetOrCreateMesh(const ModelDivision& ModelDivision)
+  {
+    const auto& vertexBuffer = ModelDivision.GetVertexBuffer();
+    const auto& elementBuffer = ModelDivision.GetElementBuffer();
+
+    // Identical divisions share one mesh so they can be drawn instanced
+
+    U32 crc = Crc32::FromData(vertexBuffer.data(), vertexBuffer.size() * sizeof(DefaultVertex));
+    crc = Crc32::FromData(elementBuffer.data(), elementBuffer.size() * sizeof(U16), crc);
+
+    U64 key = ((U64)crc << 32) | (U64)elementBuffer.size();
+
+    // The key only narrows the candidates down, a mesh is shared once the buffers are equal
 
-        //DebugRenderer::DebugBox(transform->GetWorldPosition(), transform->GetWorldScale(), R32V4{ 1.0F, 1.0F, 0.0F, 1.0F }, transform->GetQuaternion());
+    auto [meshBegin, meshEnd] = mMeshes.equal_range(key);
+
+    for (auto meshIt = meshBegin; meshIt != meshEnd; meshIt++)
+    {
+      const auto* source = meshIt->second.Source;
+
+      if (source && source->GetVertexCount() == vertexBuffer.size() && source->GetElementCount() == elementBuffer.size() &&
+        std::memcmp(source->GetVertexBuffer().data(), vertexBuffer.data(), vertexBuffer.size() * sizeof(DefaultVertex)) == 0 &&
+        std::memcmp(source->GetElementBuffer().data(), elementBuffer.data(), elementBuffer.size() * sizeof(U16)) == 0)
+      {
+        return meshIt->second.Instance;
       }
     }
+
+    Mesh<DefaultVertex, U16>* mesh = new Mesh<DefaultVertex, U16>;
+
+    mesh->UploadVertices(vertexBuffer.data(), (U32)vertexBuffer.size());
+    mesh->UploadElements(elementBuffer.data(), (U32)elementBuffer.size());
+
+    mMeshes.emplace(key, SharedMesh{ mesh, &ModelDivision });
+
+    return mesh;
+  }
+
+  Texture* Scene::AcquireTexture(const std::string& ModelName, U16 TextureIndex)
+  {
+    if (mTextureFiles.empty())
+    {
+      return nullptr;
+    }
+
+    // Prefer the DDP named after the model, otherwise fall back to the first one of the level
+
+    fs::path file = mTextureFiles[0];
+
+    for (const auto& textureFile : mTextureFiles)
+    {
+      if (textureFile.stem().string() == ModelName)
+      {
+        file = textureFile;
+
+        break;
+      }
+    }
+
+    return mTextureCache.Acquire(file, TextureIndex);
   }
 
   void Scene::Serialize()
@@ -154,13 +506,76 @@ namespace ark
 
   void Scene::DeSerialize()
   {
-    for (const auto file : fs::directory_iterator{ fs::path{ gConfig["unpackDir"].GetString() } / "levels" / mRegionId / mLevelId })
+    fs::path levelDir = fs::path{ "levels" } / mRegionId / mLevelId;
+    fs::path cacheFile = fs::path{ gConfig["unpackDir"].GetString() } / "cache" / mRegionId / (mLevelId + ".bin");
+
+    std::vector<fs::path> files = {};
+
+    // Levels which were never unpacked are extracted on their own first, unless they
+    // should be read straight from the archives
+
+    if (!gConfig.HasMember("unpackLevels") || gConfig["unpackLevels"].GetBool())
+    {
+      Packer::UnpackLevel(Packer::FromConfig(gConfig, gPacker), "levels", mRegionId, mLevelId);
+    }
+
+    for (const auto& name : gFileSystem.List(levelDir))
+    {
+      fs::path file = levelDir / name;
+
+      if (file.extension() == ".TSC") files.emplace_back(file);
+      if (file.extension() == ".TRE") files.emplace_back(file);
+      if (file.extension() == ".TAT") files.emplace_back(file);
+      if (file.extension() == ".SCR") files.emplace_back(file);
+
+      if (file.extension() == ".DDP") mTextureFiles.emplace_back(file);
+    }
+
+    std::sort(files.begin(), files.end());
+    std::sort(mTextureFiles.begin(), mTextureFiles.end());
+
+    // Files are read and hashed in parallel, parsing stays serial since it allocates from the scene arena
+
+    std::vector<std::vector<U8>> bytes = std::vector<std::vector<U8>>(files.size());
+    std::vector<LevelCacheSource> sources = std::vector<LevelCacheSource>(files.size());
+
+    JobSystem::ParallelFor((U32)files.size(), [&](U32 Index)
+    {
+      bytes[Index] = gFileSystem.ReadBinary(files[Index]);
+      sources[Index] = LevelCacheSource{ Crc32::FromString(files[Index].filename().string()), Crc32::FromBytes(bytes[Index]) };
+    });
+
+    U32 flags = ConfigModelFlags();
+
+    if (LevelCacheSerializer::Load(GetArena(), cacheFile, flags, sources, mObjects, mModelGroups))
     {
-      if (file.path().extension() == ".TSC") ObjectSerializer{ this, file };
-      if (file.path().extension() == ".TRE") ObjectSerializer{ this, file };
-      if (file.path().extension() == ".TAT") ObjectSerializer{ this, file };
+      mRevision++;
 
-      if (file.path().extension() == ".SCR") ModelSerializer{ this, file };
+      return;
     }
+
+    for (U64 i = 0; i < files.size(); i++)
+    {
+      const fs::path& file = files[i];
+
+      if (IsObjectFile(file))
+      {
+        ObjectSerializer objectSerializer = { bytes[i] };
+
+        for (const auto& object : objectSerializer.GetObjects())
+        {
+          AddObject(object);
+        }
+      }
+
+      if (file.extension() == ".SCR")
+      {
+        ModelSerializer modelSerializer = { GetArena(), file.stem().string(), bytes[i], flags };
+
+        AddModelGroup(std::move(modelSerializer.GetModelGroup()));
+      }
+    }
+
+    LevelCacheSerializer::Save(cacheFile, flags, sources, mObjects, mModelGroups);
   }
 }
\ No newline at end of file
@@ -1,13 +1,21 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <filesystem>
 #include <vector>
+#include <map>
+#include <memory>
+#include <memory_resource>
 
 #include <Common/Types.h>
+#include <Common/FileWatcher.h>
 
 #include <Editor/Forward.h>
 #include <Editor/Actor.h>
+#include <Editor/Hierarchy.h>
+#include <Editor/Registry.h>
+#include <Editor/TextureCache.h>
 
 #include <Editor/Assets/Model.h>
 #include <Editor/Assets/Object.h>
@@ -27,8 +35,32 @@ namespace rj = rapidjson;
 
 namespace ark
 {
+  /*
+   * Everything a level allocates lives in the scene arena and is released at once
+   * when the scene goes away. Actors come from a pool on top of that arena and are
+   * addressed through the generational entity of their registry slot. While the level
+   * is unpacked its directory is watched, and changed model or object files are parsed
+   * again on their own without reloading the rest of the level. Reloaded groups get an
+   * arena of their own, which is released together with the group. The revision counts
+   * structural changes, views built from the scene only need rebuilding once it moved.
+   */
   class Scene
   {
+  private:
+
+    struct ActorSlot
+    {
+      Actor* Instance = nullptr;
+      U32 Size = 0;
+      U32 Index = 0;
+    };
+
+    struct SharedMesh
+    {
+      Mesh<DefaultVertex, U16>* Instance = nullptr;
+      const ModelDivision* Source = nullptr;
+    };
+
   public:
 
     Scene(const std::string& RegionId, const std::string& LevelId);
@@ -40,41 +72,89 @@ namespace ark
     inline const auto& GetModelGroups() const { return mModelGroups; }
 
     inline const auto& GetActors() { return mActors; }
+    inline auto GetRevision() const { return mRevision; }
 
+    inline auto& GetHierarchy() { return mHierarchy; }
+    inline auto& GetRegistry() { return mRegistry; }
+    inline auto GetArena() { return &mArena; }
+    inline auto& GetTextureCache() { return mTextureCache; }
+
+    Actor* GetActor(Entity Entity) const;
     Actor* GetMainActor();
     Camera* GetMainCamera();
 
   public:
 
-    inline void AddObject(const Object& Value) { mObjects.emplace_back(Value); }
-    inline void AddModelGroup(const ModelGroup& Value) { mModelGroups.emplace_back(Value); }
+    inline void ReserveObjects(U64 Value) { mObjects.reserve(Value); }
+
+    inline void AddObject(const Object& Value) { mObjects.emplace_back(Value); mRevision++; }
+    inline void AddModelGroup(ModelGroup&& Value) { mModelGroups.emplace_back(std::move(Value)); mRevision++; }
 
   public:
 
     template<typename A, typename ... Args>
     A* CreateActor(const std::string& Name, Actor* Parent, Args&& ... Arguments);
 
+    void DestroyActor(Entity Entity);
     void DestroyActor(Actor* Actor);
 
   public:
 
     void Update(R32 TimeDelta);
 
+  private:
+
+    void RegisterActor(Actor* Actor, U32 Size);
+
   private:
 
     void Serialize();
     void DeSerialize();
 
+  private:
+
+    void Reload();
+    void ReloadModelGroup(const fs::path& File);
+    void ReloadObjects();
+
+  private:
+
+    Actor* CreateModelGroupActor(const ModelGroup& ModelGroup);
+    void ReleaseUnusedMeshes();
+
+  private:
+
+    const Mesh<DefaultVertex, U16>* GetOrCreateMesh(const ModelDivision& ModelDivision);
+    Texture* AcquireTexture(const std::string& ModelName, U16 TextureIndex);
+
   private:
 
     std::string mRegionId;
     std::string mLevelId;
 
+    std::pmr::monotonic_buffer_resource mArena = {};
+    std::pmr::unsynchronized_pool_resource mActorPool{ &mArena };
+    std::map<std::string, std::unique_ptr<std::pmr::monotonic_buffer_resource>> mModelGroupArenas = {};
+
+    Hierarchy mHierarchy = {};
+    Registry mRegistry{ &mArena };
+
     std::vector<Actor*> mActors = {};
+    std::vector<ActorSlot> mActorSlots = {};
     Actor* mMainActor = nullptr;
 
+    U64 mRevision = 0;
+
     std::vector<Object> mObjects = {};
     std::vector<ModelGroup> mModelGroups = {};
+    std::map<std::string, Entity> mModelGroupActors = {};
+
+    std::multimap<U64, SharedMesh> mMeshes = {};
+
+    std::vector<fs::path> mTextureFiles = {};
+    TextureCache mTextureCache;
+
+    FileWatcher* mFileWatcher = nullptr;
   };
 }
 
@@ -87,12 +167,16 @@ namespace ark
   template<typename A, typename ... Args>
   A* Scene::CreateActor(const std::string& Name, Actor* Parent, Args&& ... Arguments)
   {
-    auto actor = mActors.emplace_back(new A{ Name, std::forward<Args>(Arguments) ... });
+    A* actor = new (mActorPool.allocate(sizeof(A), alignof(std::max_align_t))) A{ this, Name, std::forward<Args>(Arguments) ... };
+
+    RegisterActor(actor, sizeof(A));
+
     if (Parent)
     {
       actor->SetParent(Parent);
       Parent->AddChild(actor);
     }
-    return (A*)actor;
+
+    return actor;
   }
 }
\ No newline at end of file
@@ -0,0 +1,342 @@
+#include <cstring>
+#include <fstream>
+
+#include <Common/Alignment.h>
+#include <Common/MemoryMappedFile.h>
+
+#include <Editor/Vertex.h>
+
+#include <Editor/Assets/Model.h>
+#include <Editor/Assets/Object.h>
+
+#include <Editor/Serializer/LevelCacheSerializer.h>
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  template<typename T>
+  static void Write(std::ofstream& Stream, const T* Values, U64 Count)
+  {
+    Stream.write((const char*)Values, Count * sizeof(T));
+  }
+
+  static void Pad(std::ofstream& Stream, U64 Offset)
+  {
+    static constexpr U8 sZeros[16] = {};
+
+    Stream.write((const char*)sZeros, Align<16>::Up(Offset) - Offset);
+  }
+
+  static bool Fits(U64 Offset, U64 Size, U64 Limit)
+  {
+    return Offset <= Limit && Size <= (Limit - Offset);
+  }
+}
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  U32 LevelCacheSerializer::Load(std::pmr::memory_resource* Resource, const fs::path& File, U32 Flags, const std::vector<LevelCacheSource>& Sources, std::vector<Object>& Objects, std::vector<ModelGroup>& ModelGroups)
+  {
+    MemoryMappedFile file = { File.string() };
+
+    if (!file.IsOpen() || file.GetSize() < sizeof(LevelCacheHeader))
+    {
+      return 0;
+    }
+
+    const U8* data = file.GetData();
+    const LevelCacheHeader* header = (const LevelCacheHeader*)data;
+
+    if (header->CacheId != sCacheId || header->Version != sVersion || header->Flags != Flags || header->SourceCount != Sources.size())
+    {
+      return 0;
+    }
+
+    if (!Validate(data, file.GetSize()))
+    {
+      return 0;
+    }
+
+    const LevelCacheSource* sources = (const LevelCacheSource*)(data + sizeof(LevelCacheHeader));
+
+    if (std::memcmp(sources, Sources.data(), Sources.size() * sizeof(LevelCacheSource)) != 0)
+    {
+      return 0;
+    }
+
+    const LevelCacheObject* objects = (const LevelCacheObject*)(sources + header->SourceCount);
+    const LevelCacheGroup* groups = (const LevelCacheGroup*)(objects + header->ObjectCount);
+    const LevelCacheEntry* entries = (const LevelCacheEntry*)(groups + header->GroupCount);
+    const LevelCacheDivision* divisions = (const LevelCacheDivision*)(entries + header->EntryCount);
+
+    const char* strings = (const char*)(data + header->StringOffset);
+    const DefaultVertex* vertices = (const DefaultVertex*)(data + header->VertexOffset);
+    const U16* elements = (const U16*)(data + header->ElementOffset);
+
+    Objects.reserve(Objects.size() + header->ObjectCount);
+
+    for (U32 i = 0; i < header->ObjectCount; i++)
+    {
+      Object& object = Objects.emplace_back();
+
+      object.SetId(objects[i].Id);
+      object.SetCategory(objects[i].Category);
+      object.SetPosition(objects[i].Position);
+      object.SetRotation(objects[i].Rotation);
+      object.SetScale(objects[i].Scale);
+    }
+
+    ModelGroups.reserve(ModelGroups.size() + header->GroupCount);
+
+    for (U32 i = 0; i < header->GroupCount; i++)
+    {
+      ModelGroup modelGroup = { std::string{ strings + groups[i].NameOffset, groups[i].NameSize } };
+
+      modelGroup.ReserveEntries(groups[i].EntryCount);
+
+      for (U32 j = 0; j < groups[i].EntryCount; j++, entries++)
+      {
+        ModelEntry& modelEntry = modelGroup.AddEntry(ModelEntry{ entries->Id, entries->Type });
+
+        modelEntry.SetPosition(entries->Position);
+        modelEntry.SetRotation(entries->Rotation);
+        modelEntry.SetScale(entries->Scale);
+        modelEntry.ReserveDivisions(entries->DivisionCount);
+
+        for (U32 k = 0; k < entries->DivisionCount; k++, divisions++)
+        {
+          ModelDivision& modelDivision = modelEntry.AddDivision(ModelDivision{ Resource });
+
+          modelDivision.SetTextureIndex(divisions->TextureIndex);
+          modelDivision.SetVertexBuffer(vertices, divisions->VertexCount);
+          modelDivision.SetElementBuffer(elements, divisions->ElementCount);
+
+          vertices += divisions->VertexCount;
+          elements += divisions->ElementCount;
+        }
+      }
+
+      ModelGroups.emplace_back(std::move(modelGroup));
+    }
+
+    return 1;
+  }
+
+  U32 LevelCacheSerializer::Save(const fs::path& File, U32 Flags, const std::vector<LevelCacheSource>& Sources, const std::vector<Object>& Objects, const std::vector<ModelGroup>& ModelGroups)
+  {
+    std::vector<LevelCacheObject> objects = {};
+    std::vector<LevelCacheGroup> groups = {};
+    std::vector<LevelCacheEntry> entries = {};
+    std::vector<LevelCacheDivision> divisions = {};
+
+    std::string strings = {};
+
+    U64 vertexCount = 0;
+    U64 elementCount = 0;
+
+    for (const auto& object : Objects)
+    {
+      objects.emplace_back(LevelCacheObject{ object.GetId(), object.GetCategory(), object.GetPosition(), object.GetRotation(), object.GetScale() });
+    }
+
+    for (const auto& modelGroup : ModelGroups)
+    {
+      groups.emplace_back(LevelCacheGroup{ (U32)strings.size(), (U32)modelGroup.GetName().size(), (U32)modelGroup.GetEntryCount() });
+
+      strings += modelGroup.GetName();
+
+      for (const auto& modelEntry : modelGroup)
+      {
+        entries.emplace_back(LevelCacheEntry{ modelEntry.GetId(), modelEntry.GetType(), modelEntry.GetPosition(), modelEntry.GetRotation(), modelEntry.GetScale(), (U32)modelEntry.GetDivisionCount() });
+
+        for (const auto& modelDivision : modelEntry)
+        {
+          divisions.emplace_back(LevelCacheDivision{ (U32)modelDivision.GetVertexCount(), (U32)modelDivision.GetElementCount(), modelDivision.GetTextureIndex() });
+
+          vertexCount += modelDivision.GetVertexCount();
+          elementCount += modelDivision.GetElementCount();
+        }
+      }
+    }
+
+    LevelCacheHeader header = {};
+
+    header.CacheId = sCacheId;
+    header.Version = sVersion;
+    header.Flags = Flags;
+    header.SourceCount = (U32)Sources.size();
+    header.ObjectCount = (U32)objects.size();
+    header.GroupCount = (U32)groups.size();
+    header.EntryCount = (U32)entries.size();
+    header.DivisionCount = (U32)divisions.size();
+
+    header.StringOffset = sizeof(LevelCacheHeader)
+      + Sources.size() * sizeof(LevelCacheSource)
+      + objects.size() * sizeof(LevelCacheObject)
+      + groups.size() * sizeof(LevelCacheGroup)
+      + entries.size() * sizeof(LevelCacheEntry)
+      + divisions.size() * sizeof(LevelCacheDivision);
+    header.StringSize = strings.size();
+    header.VertexOffset = Align<16>::Up(header.StringOffset + header.StringSize);
+    header.VertexSize = vertexCount * sizeof(DefaultVertex);
+    header.ElementOffset = Align<16>::Up(header.VertexOffset + header.VertexSize);
+    header.ElementSize = elementCount * sizeof(U16);
+
+    // Written next to the cache and renamed over it once complete, an interrupted save never leaves a truncated cache behind
+
+    fs::path partialFile = File;
+    partialFile += ".partial";
+
+    std::error_code error = {};
+
+    fs::create_directories(File.parent_path(), error);
+
+    std::ofstream stream = std::ofstream{ partialFile, std::ios::binary };
+
+    if (!stream.is_open())
+    {
+      return 0;
+    }
+
+    Write(stream, &header, 1);
+    Write(stream, Sources.data(), Sources.size());
+    Write(stream, objects.data(), objects.size());
+    Write(stream, groups.data(), groups.size());
+    Write(stream, entries.data(), entries.size());
+    Write(stream, divisions.data(), divisions.size());
+    Write(stream, strings.data(), strings.size());
+
+    Pad(stream, header.StringOffset + header.StringSize);
+
+    for (const auto& modelGroup : ModelGroups)
+    {
+      for (const auto& modelEntry : modelGroup)
+      {
+        for (const auto& modelDivision : modelEntry)
+        {
+          Write(stream, modelDivision.GetVertexBuffer().data(), modelDivision.GetVertexCount());
+        }
+      }
+    }
+
+    Pad(stream, header.VertexOffset + header.VertexSize);
+
+    for (const auto& modelGroup : ModelGroups)
+    {
+      for (const auto& modelEntry : modelGroup)
+      {
+        for (const auto& modelDivision : modelEntry)
+        {
+          Write(stream, modelDivision.GetElementBuffer().data(), modelDivision.GetElementCount());
+        }
+      }
+    }
+
+    stream.close();
+
+    if (stream.fail())
+    {
+      fs::remove(partialFile, error);
+
+      return 0;
+    }
+
+    fs::rename(partialFile, File, error);
+
+    if (error)
+    {
+      fs::remove(partialFile, error);
+
+      return 0;
+    }
+
+    return 1;
+  }
+
+  U32 LevelCacheSerializer::Validate(const U8* Data, U64 Size)
+  {
+    const LevelCacheHeader* header = (const LevelCacheHeader*)Data;
+
+    // Records are packed back to back between the header and the strings, the blobs follow 16 byte aligned
+
+    U64 recordSize = sizeof(LevelCacheHeader)
+      + (U64)header->SourceCount * sizeof(LevelCacheSource)
+      + (U64)header->ObjectCount * sizeof(LevelCacheObject)
+      + (U64)header->GroupCount * sizeof(LevelCacheGroup)
+      + (U64)header->EntryCount * sizeof(LevelCacheEntry)
+      + (U64)header->DivisionCount * sizeof(LevelCacheDivision);
+
+    if (header->StringOffset != recordSize || !Fits(header->StringOffset, header->StringSize, Size))
+    {
+      return 0;
+    }
+
+    if (header->VertexOffset != Align<16>::Up(header->StringOffset + header->StringSize) || !Fits(header->VertexOffset, header->VertexSize, Size))
+    {
+      return 0;
+    }
+
+    if (header->ElementOffset != Align<16>::Up(header->VertexOffset + header->VertexSize) || !Fits(header->ElementOffset, header->ElementSize, Size))
+    {
+      return 0;
+    }
+
+    const LevelCacheGroup* groups = (const LevelCacheGroup*)(Data + sizeof(LevelCacheHeader)
+      + (U64)header->SourceCount * sizeof(LevelCacheSource)
+      + (U64)header->ObjectCount * sizeof(LevelCacheObject));
+    const LevelCacheEntry* entries = (const LevelCacheEntry*)(groups + header->GroupCount);
+    const LevelCacheDivision* divisions = (const LevelCacheDivision*)(entries + header->EntryCount);
+
+    U64 entryCount = 0;
+
+    for (U32 i = 0; i < header->GroupCount; i++)
+    {
+      if (!Fits(groups[i].NameOffset, groups[i].NameSize, header->StringSize))
+      {
+        return 0;
+      }
+
+      entryCount += groups[i].EntryCount;
+    }
+
+    if (entryCount != header->EntryCount)
+    {
+      return 0;
+    }
+
+    U64 divisionCount = 0;
+
+    for (U32 i = 0; i < header->EntryCount; i++)
+    {
+      divisionCount += entries[i].DivisionCount;
+    }
+
+    if (divisionCount != header->DivisionCount)
+    {
+      return 0;
+    }
+
+    U64 vertexCount = 0;
+    U64 elementCount = 0;
+
+    for (U32 i = 0; i < header->DivisionCount; i++)
+    {
+      vertexCount += divisions[i].VertexCount;
+      elementCount += divisions[i].ElementCount;
+    }
+
+    if ((vertexCount * sizeof(DefaultVertex)) != header->VertexSize || (elementCount * sizeof(U16)) != header->ElementSize)
+    {
+      return 0;
+    }
+
+    return 1;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <vector>
+#include <filesystem>
+#include <memory_resource>
+
+#include <Common/Types.h>
+
+#include <Editor/Forward.h>
+
+///////////////////////////////////////////////////////////
+// Namespaces
+///////////////////////////////////////////////////////////
+
+namespace fs = std::filesystem;
+
+///////////////////////////////////////////////////////////
+// Definition
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  #pragma pack(push, 1)
+  struct LevelCacheHeader
+  {
+    U32 CacheId; // always 0x6C766C63
+    U32 Version;
+    U32 Flags;
+    U32 SourceCount;
+    U32 ObjectCount;
+    U32 GroupCount;
+    U32 EntryCount;
+    U32 DivisionCount;
+    U64 StringOffset;
+    U64 StringSize;
+    U64 VertexOffset;
+    U64 VertexSize;
+    U64 ElementOffset;
+    U64 ElementSize;
+  };
+  #pragma pack(pop)
+
+  #pragma pack(push, 1)
+  struct LevelCacheSource
+  {
+    U32 NameCrc;
+    U32 DataCrc;
+  };
+  #pragma pack(pop)
+
+  #pragma pack(push, 1)
+  struct LevelCacheObject
+  {
+    U8 Id;
+    U8 Category;
+    R32V3 Position;
+    R32V3 Rotation;
+    R32V3 Scale;
+  };
+  #pragma pack(pop)
+
+  #pragma pack(push, 1)
+  struct LevelCacheGroup
+  {
+    U32 NameOffset;
+    U32 NameSize;
+    U32 EntryCount;
+  };
+  #pragma pack(pop)
+
+  #pragma pack(push, 1)
+  struct LevelCacheEntry
+  {
+    U32 Id;
+    U32 Type;
+    R32V3 Position;
+    R32V3 Rotation;
+    R32V3 Scale;
+    U32 DivisionCount;
+  };
+  #pragma pack(pop)
+
+  #pragma pack(push, 1)
+  struct LevelCacheDivision
+  {
+    U32 VertexCount;
+    U32 ElementCount;
+    U16 TextureIndex;
+  };
+  #pragma pack(pop)
+
+  /*
+   * Baked copy of everything a scene parses from its level directory.
+   *
+   * The file starts with a header and the CRCs of the source files it was built
+   * from, followed by fixed size records and finally the raw vertex and element
+   * blobs. It is memory mapped on load and rejected as soon as the version, the
+   * flags or any source CRC differ, or any record or blob does not fit the file.
+   * Saving writes a partial file first and renames it into place once complete.
+   */
+  class LevelCacheSerializer
+  {
+  public:
+
+    static constexpr U32 sCacheId = 0x6C766C63;
+    static constexpr U32 sVersion = 2;
+
+  public:
+
+    static U32 Load(std::pmr::memory_resource* Resource, const fs::path& File, U32 Flags, const std::vector<LevelCacheSource>& Sources, std::vector<Object>& Objects, std::vector<ModelGroup>& ModelGroups);
+    static U32 Save(const fs::path& File, U32 Flags, const std::vector<LevelCacheSource>& Sources, const std::vector<Object>& Objects, const std::vector<ModelGroup>& ModelGroups);
+
+  private:
+
+    static U32 Validate(const U8* Data, U64 Size);
+  };
+}
\ No newline at end of file
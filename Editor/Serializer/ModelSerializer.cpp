@@ -1,10 +1,11 @@
-#include <Common/Alignment.h>
+#include <cstring>
 
-#include <Common/Utils/FileUtils.h>
+#include <Common/Alignment.h>
 
-#include <Editor/Scene.h>
 #include <Editor/Vertex.h>
 
+#include <Editor/Optimizer/MeshOptimizer.h>
+
 #include <Editor/Serializer/ModelSerializer.h>
 
 ///////////////////////////////////////////////////////////
@@ -13,9 +14,11 @@
 
 namespace ark
 {
-  ModelSerializer::ModelSerializer(Scene* Scene, const fs::path& File)
-    : mFile{ File }
-    , mBinaryReader{ FileUtils::ReadBinary(File.string()) }
+  ModelSerializer::ModelSerializer(std::pmr::memory_resource* Resource, const std::string& Name, const std::vector<U8>& Bytes, U32 Optimize)
+    : mBinaryReader{ Bytes }
+    , mResource{ Resource }
+    , mOptimize{ Optimize }
+    , mModelGroup{ Name }
   {
     U64 scrStart = mBinaryReader.GetPosition();
 
@@ -27,11 +30,11 @@ namespace ark
 
     mBinaryReader.SeekAbsolute(Align<16>::Up(mBinaryReader.GetPosition()));
 
-    ModelGroup modelGroup = { mFile.stem().string() };
+    mModelGroup.ReserveEntries(scrHeader.SubMeshCount);
 
     for (U32 i = 0; i < scrHeader.SubMeshCount; i++)
     {
-      ParseModel(modelGroup);
+      ParseModel(mModelGroup);
 
       mBinaryReader.SeekAbsolute(Align<16>::Up(mBinaryReader.GetPosition()));
     }
@@ -42,14 +45,12 @@ namespace ark
 
       ScrTransform scrTransform = mBinaryReader.Read<ScrTransform>();
 
-      ModelEntry& modelEntry = modelGroup[i];
+      ModelEntry& modelEntry = mModelGroup[i];
 
       modelEntry.SetPosition(R32V3{ scrTransform.Position.x, scrTransform.Position.y, scrTransform.Position.z });
       modelEntry.SetRotation(R32V3{ scrTransform.Rotation.x, scrTransform.Rotation.y, scrTransform.Rotation.z });
       modelEntry.SetScale(R32V3{ scrTransform.Scale.x, scrTransform.Scale.y, scrTransform.Scale.z });
     }
-
-    Scene->AddModelGroup(modelGroup);
   }
 
   void ModelSerializer::ParseModel(ModelGroup& ModelGroup)
@@ -60,7 +61,9 @@ namespace ark
 
     assert(mdbHeader.MdbId == 0x0062646D);
 
-    ModelEntry modelEntry = { mdbHeader.MeshId, mdbHeader.MeshType };
+    ModelEntry& modelEntry = ModelGroup.AddEntry(ModelEntry{ mdbHeader.MeshId, mdbHeader.MeshType });
+
+    modelEntry.ReserveDivisions(mdbHeader.MeshDivisions);
 
     std::vector<U32> divisionOffsets = mBinaryReader.Read<U32>(mdbHeader.MeshDivisions);
 
@@ -68,14 +71,15 @@ namespace ark
     {
       mBinaryReader.SeekAbsolute(mdbStart + divisionOffsets[i]);
 
-      ModelDivision modelDivision = {};
+      ModelDivision& modelDivision = modelEntry.AddDivision(ModelDivision{ mResource });
 
       ParseDivision(modelDivision);
 
-      modelEntry.AddDivision(modelDivision);
+      if (mOptimize)
+      {
+        MeshOptimizer::Optimize(modelDivision);
+      }
     }
-
-    ModelGroup.AddEntry(modelEntry);
   }
 
   void ModelSerializer::ParseDivision(ModelDivision& ModelDivision)
@@ -84,64 +88,82 @@ namespace ark
 
     MdHeader mdHeader = mBinaryReader.Read<MdHeader>();
 
-    std::vector<ScrVertex> vertices = {};
-    std::vector<U16V2> textureMaps = {};
-    std::vector<U16V2> textureUvs = {};
-    std::vector<U32> colorWeights = {};
-    std::vector<U32> elements = {};
+    const auto& bytes = mBinaryReader.GetBytes();
 
-    if (mdHeader.VertexOffset != 0)
-    {
-      mBinaryReader.SeekAbsolute(mdStart + mdHeader.VertexOffset);
-      mBinaryReader.Read<ScrVertex>(vertices, mdHeader.VertexCount);
-    }
+    // Streams are copied straight from the file into the division, missing or truncated ones stay zeroed
 
-    if (mdHeader.TextureMapOffset != 0)
+    auto hasStream = [&](U32 Offset, U64 Stride)
     {
-      mBinaryReader.SeekAbsolute(mdStart + mdHeader.TextureMapOffset);
-      mBinaryReader.Read<U16V2>(textureMaps, mdHeader.VertexCount);
-    }
+      return Offset != 0 && bytes.size() >= (mdStart + Offset + Stride * mdHeader.VertexCount);
+    };
 
-    if (mdHeader.TextureUvOffset != 0)
-    {
-      mBinaryReader.SeekAbsolute(mdStart + mdHeader.TextureUvOffset);
-      mBinaryReader.Read<U16V2>(textureUvs, mdHeader.VertexCount);
-    }
+    U32 hasVertices = hasStream(mdHeader.VertexOffset, sizeof(ScrVertex));
+    U32 hasTextureMaps = hasStream(mdHeader.TextureMapOffset, sizeof(U16V2));
+    U32 hasTextureUvs = hasStream(mdHeader.TextureUvOffset, sizeof(U16V2));
+    U32 hasColorWeights = hasStream(mdHeader.ColorWeightOffset, sizeof(U32));
+
+    // The next model follows the last stream present, in the order vertices, texture maps, texture uvs and color weights
+
+    U64 end = mBinaryReader.GetPosition();
+
+    if (mdHeader.VertexOffset) end = mdStart + mdHeader.VertexOffset + sizeof(ScrVertex) * mdHeader.VertexCount;
+    if (mdHeader.TextureMapOffset) end = mdStart + mdHeader.TextureMapOffset + sizeof(U16V2) * mdHeader.VertexCount;
+    if (mdHeader.TextureUvOffset) end = mdStart + mdHeader.TextureUvOffset + sizeof(U16V2) * mdHeader.VertexCount;
+    if (mdHeader.ColorWeightOffset) end = mdStart + mdHeader.ColorWeightOffset + sizeof(U32) * mdHeader.VertexCount;
+
+    mBinaryReader.SeekAbsolute(end);
+
+    ModelDivision.SetTextureIndex(mdHeader.TextureIndex);
+    ModelDivision.ResizeVertices(mdHeader.VertexCount);
 
-    if (mdHeader.ColorWeightOffset != 0)
+    auto& vertices = ModelDivision.GetVertexBuffer();
+
+    for (U16 i = 0; i < mdHeader.VertexCount; i++)
     {
-      mBinaryReader.SeekAbsolute(mdStart + mdHeader.ColorWeightOffset);
-      mBinaryReader.Read<U32>(colorWeights, mdHeader.VertexCount);
+      DefaultVertex& vertex = vertices[i];
+
+      if (hasVertices) std::memcpy(&vertex.Position, &bytes[mdStart + mdHeader.VertexOffset + i * sizeof(ScrVertex)], sizeof(ScrVertex));
+      if (hasTextureMaps) std::memcpy(&vertex.TextureMap, &bytes[mdStart + mdHeader.TextureMapOffset + i * sizeof(U16V2)], sizeof(U16V2));
+      if (hasTextureUvs) std::memcpy(&vertex.TextureUv, &bytes[mdStart + mdHeader.TextureUvOffset + i * sizeof(U16V2)], sizeof(U16V2));
+      if (hasColorWeights) std::memcpy(&vertex.ColorWeight, &bytes[mdStart + mdHeader.ColorWeightOffset + i * sizeof(U32)], sizeof(U32));
     }
 
-    if (mdHeader.VertexCount >= 3)
+    if (mdHeader.VertexCount >= 3 && hasVertices)
     {
+      // A connection flag on a vertex suppresses the triangle ending there, every
+      // run of connected triangles becomes one strip terminated by the restart index
+
+      U32 connected = 0;
+
+      ModelDivision.ReserveElements(mdHeader.VertexCount + mdHeader.VertexCount / 2);
+
       for (U16 i = 2; i < mdHeader.VertexCount; i++)
       {
         if (vertices[i].Connection == 0x8000)
         {
+          connected = 0;
+
           continue;
         }
-    
-        elements.emplace_back(i - 2);
-        elements.emplace_back(i - 1);
-        elements.emplace_back(i - 0);
-      }
-    }
 
-    for (U16 i = 0; i < mdHeader.VertexCount; i++)
-    {
-      R32V3 position = (mdHeader.VertexCount == vertices.size()) ? R32V3{ vertices[i].Position.x, vertices[i].Position.y, vertices[i].Position.z } : R32V3{};
-      R32V2 textureMap = (mdHeader.VertexCount == textureMaps.size()) ? R32V2{ 1000.0f / textureMaps[i].x, 1000.0f / textureMaps[i].y } : R32V2{};
-      R32V2 textureUv = (mdHeader.VertexCount == textureUvs.size()) ? R32V2{ textureUvs[i].x, textureUvs[i].y } : R32V2{};
-      U32 colorWeight = (mdHeader.VertexCount == colorWeights.size()) ? colorWeights[i] : 0;
+        if (connected)
+        {
+          ModelDivision.AddElement(i);
+        }
+        else
+        {
+          if (ModelDivision.GetElementCount())
+          {
+            ModelDivision.AddElement(0xFFFF);
+          }
 
-      ModelDivision.AddVertex(DefaultVertex{ position, textureMap, textureUv, colorWeight });
-    }
+          ModelDivision.AddElement(i - 2);
+          ModelDivision.AddElement(i - 1);
+          ModelDivision.AddElement(i - 0);
 
-    for (U16 i = 0; i < elements.size(); i++)
-    {
-      ModelDivision.AddElement(elements[i]);
+          connected = 1;
+        }
+      }
     }
   }
-}
+}
\ No newline at end of file
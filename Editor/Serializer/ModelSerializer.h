@@ -3,6 +3,7 @@
 #include <cassert>
 #include <vector>
 #include <filesystem>
+#include <memory_resource>
 
 #include <Common/Types.h>
 #include <Common/BinaryReader.h>
@@ -86,7 +87,11 @@ namespace ark
   {
   public:
 
-    ModelSerializer(Scene* Scene, const fs::path& File);
+    ModelSerializer(std::pmr::memory_resource* Resource, const std::string& Name, const std::vector<U8>& Bytes, U32 Optimize);
+
+  public:
+
+    inline auto& GetModelGroup() { return mModelGroup; }
 
   private:
 
@@ -95,7 +100,10 @@ namespace ark
 
   private:
 
-    const fs::path mFile;
     BinaryReader mBinaryReader;
+    std::pmr::memory_resource* mResource;
+    U32 mOptimize;
+
+    ModelGroup mModelGroup;
   };
 }
\ No newline at end of file
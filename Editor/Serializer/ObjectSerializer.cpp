@@ -1,7 +1,3 @@
-#include <Common/Utils/FileUtils.h>
-
-#include <Editor/Scene.h>
-
 #include <Editor/Serializer/ObjectSerializer.h>
 
 ///////////////////////////////////////////////////////////
@@ -10,12 +6,13 @@
 
 namespace ark
 {
-  ObjectSerializer::ObjectSerializer(Scene* Scene, const fs::path& File)
-    : mFile{ File }
-    , mBinaryReader{ FileUtils::ReadBinary(File.string()) }
+  ObjectSerializer::ObjectSerializer(const std::vector<U8>& Bytes)
+    : mBinaryReader{ Bytes }
   {
     U32 size = mBinaryReader.Read<U32>();
 
+    mObjects.reserve(size);
+
     for (U32 i = 0; i < size; i++)
     {
       ObjEntry objEntry = mBinaryReader.Read<ObjEntry>();
@@ -28,7 +25,7 @@ namespace ark
       object.SetRotation(R32V3{ objEntry.Rotation.x, objEntry.Rotation.y, objEntry.Rotation.z });
       object.SetScale(R32V3{ objEntry.Scale.x, objEntry.Scale.y, objEntry.Scale.z });
 
-      Scene->AddObject(object);
+      mObjects.emplace_back(object);
     }
   }
 }
@@ -1,19 +1,13 @@
 #pragma once
 
 #include <cassert>
-#include <filesystem>
+#include <vector>
 
 #include <Common/Types.h>
 #include <Common/BinaryReader.h>
 
 #include <Editor/Assets/Object.h>
 
-///////////////////////////////////////////////////////////
-// Namespaces
-///////////////////////////////////////////////////////////
-
-namespace fs = std::filesystem;
-
 ///////////////////////////////////////////////////////////
 // Definition
 ///////////////////////////////////////////////////////////
@@ -43,11 +37,16 @@ namespace ark
   {
   public:
 
-    ObjectSerializer(Scene* Scene, const fs::path& File);
+    ObjectSerializer(const std::vector<U8>& Bytes);
+
+  public:
+
+    inline const auto& GetObjects() const { return mObjects; }
 
   private:
 
-    const fs::path mFile;
     BinaryReader mBinaryReader;
+
+    std::vector<Object> mObjects = {};
   };
 }
\ No newline at end of file
@@ -111,7 +111,7 @@ namespace ark
 
         glGetShaderInfoLog(Sid, infoLogLength, &infoLogLength, &log[0]);
 
-        LOG("%s\n", &log[0]);
+        LOG_ERROR("%s\n", &log[0]);
 
         return 0;
       }
@@ -137,7 +137,7 @@ namespace ark
 
         glGetProgramInfoLog(Pid, infoLogLength, &infoLogLength, &log[0]);
 
-        LOG("%s\n", &log[0]);
+        LOG_ERROR("%s\n", &log[0]);
 
         return 0;
       }
@@ -146,6 +146,14 @@ namespace ark
     return 1;
   }
 
+  void Shader::SetUniformU32(const std::string& Name, U32 Value) const
+  {
+    glUniform1ui(
+      glGetUniformLocation(mProgram, Name.c_str()),
+      Value
+    );
+  }
+
   void Shader::SetUniformR32(const std::string& Name, R32 Value) const
   {
     glUniform1f(
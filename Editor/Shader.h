@@ -39,6 +39,7 @@ namespace ark
 
   public:
 
+    void SetUniformU32(const std::string& Name, U32 Value) const;
     void SetUniformR32(const std::string& Name, R32 Value) const;
     void SetUniformR32M4(const std::string& Name, R32M4 Value) const;
 
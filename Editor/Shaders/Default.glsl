@@ -2,7 +2,7 @@
 #version 450 core
 
 layout (location = 0) in vec3 InputPosition;
-layout (location = 1) in vec2 InputTextureMap;
+layout (location = 1) in uvec2 InputTextureMap;
 layout (location = 2) in vec2 InputTextureUv;
 layout (location = 3) in uint InputColorWeight;
 
@@ -10,17 +10,46 @@ layout (location = 0) out Vertex
 {
   vec3 Position;
   vec4 Color;
+  vec2 TextureUv;
+  flat uint TextureLayer;
+  flat float TextureMinLod;
+  flat uint Textured;
 } vertex;
 
+struct Material
+{
+  uint Layer;
+  float MinLod;
+  uint Textured;
+  uint Reserved;
+};
+
+layout (std430, binding = 0) readonly buffer InstanceBuffer
+{
+  mat4 InstanceModelMatrices[];
+};
+
+layout (std430, binding = 1) readonly buffer MaterialBuffer
+{
+  Material InstanceMaterials[];
+};
+
 uniform mat4 UniformProjectionMatrix;
 uniform mat4 UniformViewMatrix;
-uniform mat4 UniformModelMatrix;
+uniform uint UniformInstanceOffset;
 
 void main()
 {
-  vertex.Position = (UniformModelMatrix * vec4(InputPosition, 1.0)).xyz;
-  vertex.Color = vec4(InputTextureMap, 0.0, 1.0);
-  gl_Position = UniformProjectionMatrix * UniformViewMatrix * UniformModelMatrix * vec4(InputPosition, 1.0);
+  mat4 modelMatrix = InstanceModelMatrices[UniformInstanceOffset + gl_InstanceID];
+  Material material = InstanceMaterials[UniformInstanceOffset + gl_InstanceID];
+
+  vertex.Position = (modelMatrix * vec4(InputPosition, 1.0)).xyz;
+  vertex.Color = vec4(mix(vec2(0.0), 1000.0 / vec2(max(InputTextureMap, uvec2(1))), greaterThan(InputTextureMap, uvec2(0))), 0.0, 1.0);
+  vertex.TextureUv = InputTextureUv;
+  vertex.TextureLayer = material.Layer;
+  vertex.TextureMinLod = material.MinLod;
+  vertex.Textured = material.Textured;
+  gl_Position = UniformProjectionMatrix * UniformViewMatrix * modelMatrix * vec4(InputPosition, 1.0);
 }
 
 @fragment
@@ -30,11 +59,26 @@ layout (location = 0) in Vertex
 {
   vec3 Position;
   vec4 Color;
+  vec2 TextureUv;
+  flat uint TextureLayer;
+  flat float TextureMinLod;
+  flat uint Textured;
 } vertex;
 
 layout (location = 0) out vec4 OutputColor;
 
+layout (binding = 0) uniform sampler2DArray UniformTextures;
+
 void main()
 {
-  OutputColor = vertex.Color;
+  if (vertex.Textured != 0)
+  {
+    float lod = max(textureQueryLod(UniformTextures, vertex.TextureUv).y, vertex.TextureMinLod);
+
+    OutputColor = textureLod(UniformTextures, vec3(vertex.TextureUv, float(vertex.TextureLayer)), lod);
+  }
+  else
+  {
+    OutputColor = vertex.Color;
+  }
 }
\ No newline at end of file
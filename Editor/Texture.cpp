@@ -0,0 +1,189 @@
+#include <algorithm>
+#include <cstring>
+
+#include <Editor/Texture.h>
+#include <Editor/TextureArray.h>
+
+#include <Vendor/DDS/dds.h>
+#include <Vendor/GLAD/glad.h>
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+  #define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#endif
+
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT3_EXT
+  #define GL_COMPRESSED_RGBA_S3TC_DXT3_EXT 0x83F2
+#endif
+
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+  #define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
+namespace ark
+{
+  static constexpr U32 sDdsMagic = 0x20534444;
+  static constexpr U32 sFourCcDxt1 = 0x31545844;
+  static constexpr U32 sFourCcDxt3 = 0x33545844;
+  static constexpr U32 sFourCcDxt5 = 0x35545844;
+}
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  Texture::Texture(const fs::path& File, U32 Index)
+    : mFile{ File }
+    , mIndex{ Index }
+  {
+
+  }
+
+  Texture::~Texture()
+  {
+    Release();
+  }
+
+  U32 Texture::Parse(const std::vector<U8>& Bytes)
+  {
+    mMips.clear();
+    mBytes.clear();
+    mStorageSize = 0;
+
+    if (Bytes.size() < (sizeof(U32) + sizeof(dds_header)) || *(const U32*)&Bytes[0] != sDdsMagic)
+    {
+      return 0;
+    }
+
+    dds_header header = {};
+
+    std::memcpy(&header, &Bytes[sizeof(U32)], sizeof(dds_header));
+
+    U32 width = std::max(1U, header.width);
+    U32 height = std::max(1U, header.height);
+
+    U32 blockSize = 0;
+
+    if (header.pixel_format.flags & DDPF_FOURCC)
+    {
+      switch (header.pixel_format.four_cc)
+      {
+        case sFourCcDxt1: mFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; blockSize = 8; break;
+        case sFourCcDxt3: mFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT; blockSize = 16; break;
+        case sFourCcDxt5: mFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; blockSize = 16; break;
+      }
+    }
+
+    if (blockSize)
+    {
+      // Block compressed data goes to the GPU as is
+
+      U32 mipCount = (header.flags & DDSD_MIPMAPCOUNT) ? std::max(1U, header.mipmap_count) : 1;
+      U64 offset = sizeof(U32) + sizeof(dds_header);
+
+      for (U32 i = 0; i < mipCount; i++)
+      {
+        U64 size = (U64)std::max(1U, (width + 3) / 4) * std::max(1U, (height + 3) / 4) * blockSize;
+
+        if ((offset + size) > Bytes.size())
+        {
+          break;
+        }
+
+        mMips.emplace_back(TextureMip{ width, height, offset, size });
+
+        offset += size;
+        width = std::max(1U, width / 2);
+        height = std::max(1U, height / 2);
+      }
+
+      mBytes = Bytes;
+      mCompressed = 1;
+    }
+    else
+    {
+      // Everything else is expanded to RGBA by the DDS loader, without mips
+
+      dds_image* image = dds_load_from_memory((const char*)Bytes.data(), (long)Bytes.size());
+
+      if (image)
+      {
+        U64 size = (U64)width * height * 4;
+
+        mBytes.assign(image->pixels, image->pixels + size);
+        mMips.emplace_back(TextureMip{ width, height, 0, size });
+
+        dds_image_free(image);
+      }
+
+      mFormat = GL_RGBA8;
+      mCompressed = 0;
+    }
+
+    for (const auto& mip : mMips)
+    {
+      mStorageSize += mip.Size;
+    }
+
+    return !mMips.empty();
+  }
+
+  void Texture::Allocate(TextureArray* Array)
+  {
+    Release();
+
+    mArray = Array;
+    mLayer = mArray->AllocateLayer(this);
+
+    mResidentMip = (U32)mMips.size();
+  }
+
+  U64 Texture::UploadNextMip()
+  {
+    if (mResidentMip == 0)
+    {
+      return 0;
+    }
+
+    mResidentMip--;
+
+    const TextureMip& mip = mMips[mResidentMip];
+
+    if (mCompressed)
+    {
+      glCompressedTextureSubImage3D(mArray->GetId(), (I32)mResidentMip, 0, 0, (I32)mLayer, (I32)mip.Width, (I32)mip.Height, 1, mFormat, (I32)mip.Size, &mBytes[mip.Offset]);
+    }
+    else
+    {
+      glTextureSubImage3D(mArray->GetId(), (I32)mResidentMip, 0, 0, (I32)mLayer, (I32)mip.Width, (I32)mip.Height, 1, GL_RGBA, GL_UNSIGNED_BYTE, &mBytes[mip.Offset]);
+    }
+
+    mState = eTextureStateResident;
+
+    if (mResidentMip == 0)
+    {
+      mBytes.clear();
+      mBytes.shrink_to_fit();
+    }
+
+    return mip.Size;
+  }
+
+  void Texture::Release()
+  {
+    if (mArray)
+    {
+      mArray->FreeLayer(mLayer);
+
+      mArray = nullptr;
+      mLayer = 0;
+    }
+
+    mResidentMip = 0;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <filesystem>
+
+#include <Common/Types.h>
+
+#include <Editor/Forward.h>
+
+///////////////////////////////////////////////////////////
+// Namespaces
+///////////////////////////////////////////////////////////
+
+namespace fs = std::filesystem;
+
+///////////////////////////////////////////////////////////
+// Definition
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  enum TextureState
+  {
+    eTextureStateUnloaded,
+    eTextureStateQueued,
+    eTextureStateParsed,
+    eTextureStateResident,
+    eTextureStateFailed,
+  };
+
+  struct TextureMip
+  {
+    U32 Width;
+    U32 Height;
+    U64 Offset;
+    U64 Size;
+  };
+
+  /*
+   * One DDS image out of a DDP archive.
+   *
+   * Parsing happens on the streaming thread and only produces the file bytes plus
+   * the location of every mip level. On upload the texture claims one layer of the
+   * array matching its format and size, mips are then filled smallest first while
+   * the shader clamps sampling to the finest mip resident so far. The array moves
+   * the texture to another layer whenever it compacts.
+   */
+  class Texture
+  {
+  public:
+
+    Texture(const fs::path& File, U32 Index);
+    Texture(const Texture& Other) = delete;
+    virtual ~Texture();
+
+  public:
+
+    inline const auto& GetFile() const { return mFile; }
+    inline auto GetIndex() const { return mIndex; }
+    inline auto GetArray() const { return mArray; }
+    inline auto GetLayer() const { return mLayer; }
+    inline auto GetState() const { return mState.load(); }
+    inline auto GetFormat() const { return mFormat; }
+    inline auto GetWidth() const { return mMips.empty() ? 0 : mMips[0].Width; }
+    inline auto GetHeight() const { return mMips.empty() ? 0 : mMips[0].Height; }
+    inline auto GetMipCount() const { return (U32)mMips.size(); }
+    inline auto GetResidentMip() const { return mResidentMip; }
+    inline auto GetStorageSize() const { return mStorageSize; }
+
+    inline auto IsResident() const { return mState == eTextureStateResident; }
+    inline auto IsComplete() const { return mState == eTextureStateResident && mResidentMip == 0; }
+
+  public:
+
+    inline void SetState(TextureState Value) { mState = Value; }
+    inline void SetLayer(U32 Value) { mLayer = Value; }
+
+  public:
+
+    U32 Parse(const std::vector<U8>& Bytes);
+
+    void Allocate(TextureArray* Array);
+    U64 UploadNextMip();
+    void Release();
+
+  private:
+
+    fs::path mFile;
+    U32 mIndex;
+
+    std::atomic<TextureState> mState = eTextureStateUnloaded;
+
+    TextureArray* mArray = nullptr;
+    U32 mLayer = 0;
+    U32 mFormat = 0;
+    U32 mCompressed = 0;
+    U32 mResidentMip = 0;
+    U64 mStorageSize = 0;
+
+    std::vector<U8> mBytes = {};
+    std::vector<TextureMip> mMips = {};
+  };
+}
\ No newline at end of file
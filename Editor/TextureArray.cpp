@@ -0,0 +1,123 @@
+#include <algorithm>
+
+#include <Editor/Texture.h>
+#include <Editor/TextureArray.h>
+
+#include <Vendor/GLAD/glad.h>
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  TextureArray::TextureArray(U32 Format, U32 Width, U32 Height, U32 MipCount, U64 LayerSize)
+    : mFormat{ Format }
+    , mWidth{ Width }
+    , mHeight{ Height }
+    , mMipCount{ MipCount }
+    , mLayerSize{ LayerSize }
+  {
+
+  }
+
+  TextureArray::~TextureArray()
+  {
+    glDeleteTextures(1, &mId);
+  }
+
+  U32 TextureArray::AllocateLayer(Texture* Owner)
+  {
+    if (mOwners.size() == mCapacity)
+    {
+      Resize(std::max(4U, mCapacity * 2));
+    }
+
+    mOwners.emplace_back(Owner);
+
+    return (U32)mOwners.size() - 1;
+  }
+
+  void TextureArray::FreeLayer(U32 Layer)
+  {
+    U32 last = (U32)mOwners.size() - 1;
+
+    if (Layer != last)
+    {
+      for (U32 i = 0; i < mMipCount; i++)
+      {
+        I32 width = (I32)std::max(1U, mWidth >> i);
+        I32 height = (I32)std::max(1U, mHeight >> i);
+
+        glCopyImageSubData(mId, GL_TEXTURE_2D_ARRAY, (I32)i, 0, 0, (I32)last, mId, GL_TEXTURE_2D_ARRAY, (I32)i, 0, 0, (I32)Layer, width, height, 1);
+      }
+
+      mOwners[Layer] = mOwners[last];
+      mOwners[Layer]->SetLayer(Layer);
+    }
+
+    mOwners.pop_back();
+
+    if (mOwners.empty())
+    {
+      Resize(0);
+    }
+    else if (mCapacity > 4 && mOwners.size() <= (mCapacity / 4))
+    {
+      Resize(mCapacity / 2);
+    }
+  }
+
+  void TextureArray::Reserve(U32 Capacity)
+  {
+    if (Capacity > mCapacity)
+    {
+      Resize(Capacity);
+    }
+  }
+
+  void TextureArray::Trim()
+  {
+    // Arrays with only a few spare layers keep them, the next allocation would grow them right back
+
+    if (mCapacity > 4 && mOwners.size() <= (mCapacity / 2))
+    {
+      Resize((U32)mOwners.size());
+    }
+  }
+
+  void TextureArray::Resize(U32 Capacity)
+  {
+    U32 id = 0;
+
+    if (Capacity)
+    {
+      glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &id);
+      glTextureStorage3D(id, (I32)mMipCount, mFormat, (I32)mWidth, (I32)mHeight, (I32)Capacity);
+
+      glTextureParameteri(id, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+      glTextureParameteri(id, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+      glTextureParameteri(id, GL_TEXTURE_WRAP_S, GL_REPEAT);
+      glTextureParameteri(id, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    }
+
+    if (mId)
+    {
+      if (id && !mOwners.empty())
+      {
+        for (U32 i = 0; i < mMipCount; i++)
+        {
+          I32 width = (I32)std::max(1U, mWidth >> i);
+          I32 height = (I32)std::max(1U, mHeight >> i);
+
+          glCopyImageSubData(mId, GL_TEXTURE_2D_ARRAY, (I32)i, 0, 0, 0, id, GL_TEXTURE_2D_ARRAY, (I32)i, 0, 0, 0, width, height, (I32)mOwners.size());
+        }
+      }
+
+      glDeleteTextures(1, &mId);
+    }
+
+    mId = id;
+    mCapacity = Capacity;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <vector>
+
+#include <Common/Types.h>
+
+#include <Editor/Forward.h>
+
+///////////////////////////////////////////////////////////
+// Definition
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  /*
+   * Layered storage shared by all textures of one format, size and mip count.
+   *
+   * Layers are handed out to textures and stay densely packed, freeing a layer
+   * moves the last one into the gap on the GPU. Running out of layers doubles the
+   * capacity unless Reserve grew it beforehand, dropping to a quarter of it halves
+   * the capacity again and Trim cuts an array at least half empty down to the
+   * layers in use. The storage size reports what is allocated on the GPU rather
+   * than what is in use.
+   */
+  class TextureArray
+  {
+  public:
+
+    TextureArray(U32 Format, U32 Width, U32 Height, U32 MipCount, U64 LayerSize);
+    TextureArray(const TextureArray& Other) = delete;
+    virtual ~TextureArray();
+
+  public:
+
+    inline auto GetId() const { return mId; }
+    inline auto GetFormat() const { return mFormat; }
+    inline auto GetWidth() const { return mWidth; }
+    inline auto GetHeight() const { return mHeight; }
+    inline auto GetMipCount() const { return mMipCount; }
+    inline auto GetLayerCount() const { return (U32)mOwners.size(); }
+    inline auto GetCapacity() const { return mCapacity; }
+    inline auto GetLayerSize() const { return mLayerSize; }
+    inline auto GetUsedSize() const { return mOwners.size() * mLayerSize; }
+    inline auto GetStorageSize() const { return mCapacity * mLayerSize; }
+
+    inline auto IsFull() const { return mOwners.size() == mCapacity; }
+
+  public:
+
+    U32 AllocateLayer(Texture* Owner);
+    void FreeLayer(U32 Layer);
+    void Reserve(U32 Capacity);
+    void Trim();
+
+  private:
+
+    void Resize(U32 Capacity);
+
+  private:
+
+    U32 mId = 0;
+    U32 mFormat;
+    U32 mWidth;
+    U32 mHeight;
+    U32 mMipCount;
+    U64 mLayerSize;
+
+    U32 mCapacity = 0;
+
+    std::vector<Texture*> mOwners = {};
+  };
+}
\ No newline at end of file
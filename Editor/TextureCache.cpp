@@ -0,0 +1,360 @@
+#include <algorithm>
+#include <memory>
+
+#include <Common/VirtualFileSystem.h>
+
+#include <Common/Trees/ArchiveNode.h>
+
+#include <Editor/Profiler.h>
+#include <Editor/Texture.h>
+#include <Editor/TextureArray.h>
+#include <Editor/TextureCache.h>
+
+///////////////////////////////////////////////////////////
+// Globals
+///////////////////////////////////////////////////////////
+
+extern ark::VirtualFileSystem gFileSystem;
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  TextureCache::TextureCache(U64 Budget, U64 UploadBudget)
+    : mBudget{ Budget }
+    , mUploadBudget{ UploadBudget }
+    , mWorker{ &TextureCache::Work, this }
+  {
+
+  }
+
+  TextureCache::~TextureCache()
+  {
+    {
+      std::lock_guard<std::mutex> lock{ mMutex };
+
+      mRunning = 0;
+    }
+
+    mCondition.notify_all();
+    mWorker.join();
+
+    for (auto& [key, texture] : mTextures)
+    {
+      delete texture;
+      texture = nullptr;
+    }
+
+    for (auto& [key, array] : mArrays)
+    {
+      delete array;
+      array = nullptr;
+    }
+  }
+
+  Texture* TextureCache::Acquire(const fs::path& File, U32 Index)
+  {
+    auto key = std::make_pair(File.string(), Index);
+    auto textureIt = mTextures.find(key);
+
+    if (textureIt != mTextures.end())
+    {
+      return textureIt->second;
+    }
+
+    Texture* texture = new Texture{ File, Index };
+
+    mTextures.emplace(key, texture);
+
+    Request(texture);
+
+    return texture;
+  }
+
+  void TextureCache::Touch(Texture* Texture)
+  {
+    auto lruIt = mLruIndices.find(Texture);
+
+    if (lruIt != mLruIndices.end())
+    {
+      mLru.splice(mLru.begin(), mLru, lruIt->second);
+    }
+    else if (Texture->GetState() == eTextureStateUnloaded && CanRequest(Texture))
+    {
+      Request(Texture);
+    }
+  }
+
+  void TextureCache::Update()
+  {
+    ProfilerCpuScope scope{ "Texture Streaming" };
+
+    mFrame++;
+
+    {
+      std::lock_guard<std::mutex> lock{ mMutex };
+
+      for (auto texture : mParsed)
+      {
+        TextureArray* array = GetOrCreateArray(texture);
+
+        Reserve(array);
+
+        texture->Allocate(array);
+
+        auto admissionIt = mAdmissions.find(texture);
+
+        if (admissionIt != mAdmissions.end())
+        {
+          mAdmittedSize -= admissionIt->second;
+          mAdmissions.erase(admissionIt);
+        }
+
+        mLruIndices.emplace(texture, mLru.insert(mLru.begin(), texture));
+        mUploads.emplace_back(texture);
+      }
+
+      mParsed.clear();
+    }
+
+    // Upload coarse mips of everything first, finer mips only when the budget allows it
+
+    U64 uploaded = 0;
+
+    while (!mUploads.empty() && uploaded < mUploadBudget)
+    {
+      U64 uploadedBefore = uploaded;
+
+      for (auto texture : mUploads)
+      {
+        if (uploaded < mUploadBudget)
+        {
+          uploaded += texture->UploadNextMip();
+        }
+      }
+
+      mUploads.erase(std::remove_if(mUploads.begin(), mUploads.end(), [](Texture* Texture) { return Texture->IsComplete(); }), mUploads.end());
+
+      if (uploaded == uploadedBefore)
+      {
+        break;
+      }
+    }
+
+    Profiler::CountUploadBytes(uploaded);
+
+    // The budget holds against what the arrays allocate, evict until the layers in use fit and cut mostly empty arrays down to them
+
+    if (GetAllocatedSize() > mBudget)
+    {
+      U64 usedSize = 0;
+
+      for (const auto& [key, array] : mArrays)
+      {
+        usedSize += array->GetUsedSize();
+      }
+
+      while (usedSize > mBudget && mLru.size() > 1)
+      {
+        usedSize -= mLru.back()->GetStorageSize();
+
+        Evict(mLru.back());
+      }
+
+      for (const auto& [key, array] : mArrays)
+      {
+        array->Trim();
+      }
+    }
+
+    mResidentSize = GetAllocatedSize();
+  }
+
+  TextureArray* TextureCache::GetOrCreateArray(const Texture* Texture)
+  {
+    auto key = std::make_tuple(Texture->GetFormat(), Texture->GetWidth(), Texture->GetHeight(), Texture->GetMipCount());
+    auto arrayIt = mArrays.find(key);
+
+    if (arrayIt != mArrays.end())
+    {
+      return arrayIt->second;
+    }
+
+    TextureArray* array = new TextureArray{ Texture->GetFormat(), Texture->GetWidth(), Texture->GetHeight(), Texture->GetMipCount(), Texture->GetStorageSize() };
+
+    mArrays.emplace(key, array);
+
+    return array;
+  }
+
+  U64 TextureCache::GetAllocatedSize() const
+  {
+    U64 allocatedSize = 0;
+
+    for (const auto& [key, array] : mArrays)
+    {
+      allocatedSize += array->GetStorageSize();
+    }
+
+    return allocatedSize;
+  }
+
+  void TextureCache::Reserve(TextureArray* Array)
+  {
+    if (!Array->IsFull())
+    {
+      return;
+    }
+
+    // Growing copies every layer into new storage allocated next to the old one, so the new storage has to fit on top
+
+    U64 allocatedSize = GetAllocatedSize();
+    U64 availableLayers = (mBudget > allocatedSize) ? ((mBudget - allocatedSize) / std::max<U64>(1, Array->GetLayerSize())) : 0;
+    U32 capacity = std::max(4U, Array->GetCapacity() * 2);
+
+    if (availableLayers >= capacity)
+    {
+      Array->Reserve(capacity);
+
+      return;
+    }
+
+    // Without room to double, the least recently touched texture of the same array hands over its layer
+
+    auto lruIt = std::find_if(mLru.rbegin(), mLru.rend(), [Array](Texture* Texture) { return Texture->GetArray() == Array; });
+
+    if (lruIt != mLru.rend())
+    {
+      Evict(*lruIt);
+
+      return;
+    }
+
+    // A new array takes what still fits, at least the one layer
+
+    Array->Reserve(std::max(1U, (U32)std::min<U64>(availableLayers, capacity)));
+  }
+
+  U32 TextureCache::CanRequest(Texture* Texture)
+  {
+    auto evictionIt = mEvictions.find(Texture);
+
+    if (evictionIt == mEvictions.end())
+    {
+      return 1;
+    }
+
+    const TextureEviction& eviction = evictionIt->second;
+
+    // Re-admitted textures still being parsed hold on to their size, several of them can not overshoot the budget at once
+
+    if ((mFrame - eviction.Frame) < sEvictionCooldown || (mResidentSize + mAdmittedSize + eviction.StorageSize) > mBudget)
+    {
+      return 0;
+    }
+
+    mAdmittedSize += eviction.StorageSize;
+    mAdmissions.emplace(Texture, eviction.StorageSize);
+    mEvictions.erase(evictionIt);
+
+    return 1;
+  }
+
+  void TextureCache::Request(Texture* Texture)
+  {
+    Texture->SetState(eTextureStateQueued);
+
+    {
+      std::lock_guard<std::mutex> lock{ mMutex };
+
+      mPending.emplace_back(Texture);
+    }
+
+    mCondition.notify_one();
+  }
+
+  void TextureCache::Evict(Texture* Texture)
+  {
+    auto lruIt = mLruIndices.find(Texture);
+
+    if (lruIt != mLruIndices.end())
+    {
+      mLru.erase(lruIt->second);
+      mLruIndices.erase(lruIt);
+    }
+
+    mUploads.erase(std::remove(mUploads.begin(), mUploads.end(), Texture), mUploads.end());
+
+    mEvictions[Texture] = TextureEviction{ mFrame, Texture->GetStorageSize() };
+
+    Texture->Release();
+    Texture->SetState(eTextureStateUnloaded);
+  }
+
+  void TextureCache::Work()
+  {
+    // Consecutive requests usually hit the same DDP, keep the last one around
+
+    std::string archiveFile = {};
+    std::unique_ptr<ArchiveNode> archive = nullptr;
+
+    while (true)
+    {
+      Texture* texture = nullptr;
+
+      {
+        std::unique_lock<std::mutex> lock{ mMutex };
+
+        mCondition.wait(lock, [this] { return !mRunning || !mPending.empty(); });
+
+        if (!mRunning)
+        {
+          break;
+        }
+
+        texture = mPending.front();
+
+        mPending.pop_front();
+      }
+
+      if (texture->GetFile().string() != archiveFile)
+      {
+        archiveFile = texture->GetFile().string();
+        archive = std::make_unique<ArchiveNode>(gFileSystem.ReadBinary(archiveFile));
+      }
+
+      U32 index = 0;
+      U32 parsed = 0;
+
+      if (archive->IsArchive())
+      {
+        for (const auto& [type, node] : *archive)
+        {
+          if (type == "DDS" && index++ == texture->GetIndex())
+          {
+            parsed = texture->Parse(node->GetBytes());
+
+            break;
+          }
+        }
+      }
+
+      {
+        std::lock_guard<std::mutex> lock{ mMutex };
+
+        if (parsed)
+        {
+          texture->SetState(eTextureStateParsed);
+
+          mParsed.emplace_back(texture);
+        }
+        else
+        {
+          texture->SetState(eTextureStateFailed);
+        }
+      }
+    }
+  }
+}
\ No newline at end of file
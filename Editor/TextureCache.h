@@ -0,0 +1,111 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <list>
+#include <map>
+#include <tuple>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <filesystem>
+
+#include <Common/Types.h>
+
+#include <Editor/Forward.h>
+
+///////////////////////////////////////////////////////////
+// Namespaces
+///////////////////////////////////////////////////////////
+
+namespace fs = std::filesystem;
+
+///////////////////////////////////////////////////////////
+// Definition
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  /*
+   * Owns all textures of a scene and keeps them within a VRAM budget.
+   *
+   * Textures are read and parsed on a background thread. Update runs on the render
+   * thread once per frame, uploads at most the upload budget worth of mips and
+   * makes room for every parsed texture before it claims a layer, either by growing
+   * its array as far as the budget allows or by evicting the least recently touched
+   * texture of the same array. Whatever still exceeds the budget afterwards is
+   * evicted least recently touched first. Evicted textures are streamed in again when
+   * touched after a cooldown and only if they fit into the budget, so a level
+   * exceeding it does not evict and re-stream the same textures every frame.
+   * Textures sharing format, size and mip count are packed into the layers of one
+   * array texture so the renderer only switches bindings between arrays.
+   */
+  class TextureCache
+  {
+  public:
+
+    static constexpr U64 sEvictionCooldown = 120;
+
+  private:
+
+    struct TextureEviction
+    {
+      U64 Frame = 0;
+      U64 StorageSize = 0;
+    };
+
+  public:
+
+    TextureCache(U64 Budget, U64 UploadBudget);
+    virtual ~TextureCache();
+
+  public:
+
+    inline auto GetResidentSize() const { return mResidentSize; }
+
+  public:
+
+    Texture* Acquire(const fs::path& File, U32 Index);
+
+    void Touch(Texture* Texture);
+    void Update();
+
+  private:
+
+    TextureArray* GetOrCreateArray(const Texture* Texture);
+    U64 GetAllocatedSize() const;
+
+    void Reserve(TextureArray* Array);
+    U32 CanRequest(Texture* Texture);
+    void Request(Texture* Texture);
+    void Evict(Texture* Texture);
+    void Work();
+
+  private:
+
+    U64 mBudget;
+    U64 mUploadBudget;
+    U64 mResidentSize = 0;
+    U64 mAdmittedSize = 0;
+    U64 mFrame = 0;
+
+    std::map<std::pair<std::string, U32>, Texture*> mTextures = {};
+    std::map<std::tuple<U32, U32, U32, U32>, TextureArray*> mArrays = {};
+
+    std::list<Texture*> mLru = {};
+    std::map<Texture*, std::list<Texture*>::iterator> mLruIndices = {};
+
+    std::vector<Texture*> mUploads = {};
+    std::map<Texture*, TextureEviction> mEvictions = {};
+    std::map<Texture*, U64> mAdmissions = {};
+
+    std::mutex mMutex = {};
+    std::condition_variable mCondition = {};
+    std::deque<Texture*> mPending = {};
+    std::vector<Texture*> mParsed = {};
+    U32 mRunning = 1;
+
+    std::thread mWorker;
+  };
+}
\ No newline at end of file
@@ -14,14 +14,19 @@ namespace ark
     eVertexTypeDebug,
   };
 
+  /*
+   * Keeps the quantized attributes exactly as they are stored in SCR files,
+   * decoding happens in the vertex shader.
+   */
   #pragma pack(push, 1)
   struct DefaultVertex
   {
     static constexpr VertexType Type = eVertexTypeDefault;
 
-    R32V3 Position;
-    R32V2 TextureMap;
-    R32V2 TextureUv;
+    I16V3 Position;
+    U16 Connection;
+    U16V2 TextureMap;
+    U16V2 TextureUv;
     U32 ColorWeight;
   };
   #pragma pack(pop)
@@ -0,0 +1,330 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+
+#include <Generator/Dataset.h>
+
+#include <Editor/Serializer/ModelSerializer.h>
+#include <Editor/Serializer/ObjectSerializer.h>
+
+#include <Vendor/DDS/dds.h>
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  template<typename T>
+  static void Append(std::vector<U8>& Bytes, const T& Value)
+  {
+    U64 offset = Bytes.size();
+
+    Bytes.resize(offset + sizeof(T));
+
+    std::memcpy(&Bytes[offset], &Value, sizeof(T));
+  }
+
+  template<typename T>
+  static void Patch(std::vector<U8>& Bytes, U64 Offset, const T& Value)
+  {
+    std::memcpy(&Bytes[Offset], &Value, sizeof(T));
+  }
+
+  static void PadTo(std::vector<U8>& Bytes, U64 Alignment)
+  {
+    Bytes.resize((Bytes.size() + Alignment - 1) / Alignment * Alignment, 0);
+  }
+
+  static constexpr const char* sFillerTypes[] = { "MOT", "EFF", "SEQ", "SCA", "SEH", "MSD", "BIN", "CAM", "ECT", "ITS" };
+  static constexpr U32 sFillerTypeCount = sizeof(sFillerTypes) / sizeof(sFillerTypes[0]);
+}
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  std::vector<U8> Dataset::RandomBytes(U64 Size, U32 Seed)
+  {
+    std::mt19937 generator = std::mt19937{ Seed };
+    std::vector<U8> bytes = std::vector<U8>(Size);
+
+    for (auto& byte : bytes)
+    {
+      byte = (U8)generator();
+    }
+
+    return bytes;
+  }
+
+  std::vector<U8> Dataset::Archive(const std::vector<DatasetEntry>& Entries)
+  {
+    // Table of contents, every entry is preceded by 4 reserved bytes and a 20 byte name
+
+    std::vector<U8> bytes = {};
+
+    Append(bytes, (U32)Entries.size());
+
+    for (U32 i = 0; i < Entries.size(); i++)
+    {
+      Append(bytes, (U32)0);
+    }
+
+    for (const auto& entry : Entries)
+    {
+      char type[4] = {};
+
+      std::memcpy(type, entry.Type.c_str(), std::min<U64>(entry.Type.size(), 4));
+
+      Append(bytes, type);
+    }
+
+    for (U32 i = 0; i < Entries.size(); i++)
+    {
+      char name[20] = {};
+
+      std::memcpy(name, Entries[i].Name.c_str(), std::min<U64>(Entries[i].Name.size(), 19));
+
+      Append(bytes, (U32)0);
+      Append(bytes, name);
+
+      Patch(bytes, sizeof(U32) + i * sizeof(U32), (U32)bytes.size());
+
+      bytes.insert(bytes.end(), Entries[i].Bytes.begin(), Entries[i].Bytes.end());
+    }
+
+    bytes.resize(bytes.size() + 25, 0);
+
+    return bytes;
+  }
+
+  std::vector<U8> Dataset::NestedArchive(U32 OuterCount, U32 InnerCount, U64 FileSize, U32 Seed)
+  {
+    std::vector<DatasetEntry> outerEntries = {};
+
+    for (U32 i = 0; i < OuterCount; i++)
+    {
+      std::vector<DatasetEntry> innerEntries = {};
+
+      for (U32 j = 0; j < InnerCount; j++)
+      {
+        std::string type = sFillerTypes[(i + j) % sFillerTypeCount];
+
+        // Leading zeros keep the payload from being mistaken for another archive
+
+        std::vector<U8> payload = RandomBytes(FileSize, Seed + i * InnerCount + j);
+
+        std::memset(payload.data(), 0, std::min<U64>(payload.size(), sizeof(U32)));
+
+        innerEntries.emplace_back(DatasetEntry{ type, "f" + std::to_string(i) + "_" + std::to_string(j), std::move(payload) });
+      }
+
+      outerEntries.emplace_back(DatasetEntry{ "DAT", "a" + std::to_string(i), Archive(innerEntries) });
+    }
+
+    return Archive(outerEntries);
+  }
+
+  std::vector<U8> Dataset::Scr(U32 SubMeshCount, U32 DivisionCount, U32 VertexCount, U32 TextureCount, U32 Seed)
+  {
+    std::mt19937 generator = std::mt19937{ Seed };
+    std::vector<U8> bytes = {};
+
+    Append(bytes, ScrHeader{ 0x00726373, 1, SubMeshCount, 0 });
+
+    U64 transformOffsets = bytes.size();
+
+    for (U32 i = 0; i < SubMeshCount; i++)
+    {
+      Append(bytes, (U32)0);
+    }
+
+    for (U32 i = 0; i < SubMeshCount; i++)
+    {
+      PadTo(bytes, 16);
+
+      U64 mdbStart = bytes.size();
+
+      MdbHeader mdbHeader = {};
+
+      mdbHeader.MdbId = 0x0062646D;
+      mdbHeader.MeshType = 0x20;
+      mdbHeader.MeshId = (U16)i;
+      mdbHeader.MeshDivisions = (U16)DivisionCount;
+
+      Append(bytes, mdbHeader);
+
+      U64 divisionOffsets = bytes.size();
+
+      for (U32 j = 0; j < DivisionCount; j++)
+      {
+        Append(bytes, (U32)0);
+      }
+
+      for (U32 j = 0; j < DivisionCount; j++)
+      {
+        U64 mdStart = bytes.size();
+
+        Patch(bytes, divisionOffsets + j * sizeof(U32), (U32)(mdStart - mdbStart));
+
+        // Streams follow the header back to back in the order the parser expects them
+
+        MdHeader mdHeader = {};
+
+        mdHeader.VertexCount = (U16)VertexCount;
+        mdHeader.TextureIndex = (U16)((i + j) % std::max(TextureCount, 1U));
+        mdHeader.VertexOffset = sizeof(MdHeader);
+        mdHeader.TextureMapOffset = (U32)(mdHeader.VertexOffset + VertexCount * sizeof(ScrVertex));
+        mdHeader.TextureUvOffset = (U32)(mdHeader.TextureMapOffset + VertexCount * sizeof(U16V2));
+        mdHeader.ColorWeightOffset = (U32)(mdHeader.TextureUvOffset + VertexCount * sizeof(U16V2));
+
+        Append(bytes, mdHeader);
+
+        for (U32 k = 0; k < VertexCount; k++)
+        {
+          // A strip break roughly every 16 vertices
+
+          ScrVertex vertex = {};
+
+          vertex.Position = I16V3{ (I16)(generator() % 2048), (I16)(generator() % 2048), (I16)(generator() % 2048) };
+          vertex.Connection = ((k % 16) < 2) ? 0x8000 : 0;
+
+          Append(bytes, vertex);
+        }
+
+        for (U32 k = 0; k < VertexCount; k++) Append(bytes, U16V2{ 1000, 1000 });
+        for (U32 k = 0; k < VertexCount; k++) Append(bytes, U16V2{ (U16)generator(), (U16)generator() });
+        for (U32 k = 0; k < VertexCount; k++) Append(bytes, (U32)generator());
+      }
+    }
+
+    PadTo(bytes, 16);
+
+    for (U32 i = 0; i < SubMeshCount; i++)
+    {
+      ScrTransform transform = {};
+
+      transform.SubmeshIndex = i;
+      transform.Scale = U16V3{ 4096, 4096, 4096 };
+      transform.Position = I16V3{ (I16)(generator() % 1024), 0, (I16)(generator() % 1024) };
+
+      Patch(bytes, transformOffsets + i * sizeof(U32), (U32)bytes.size());
+
+      Append(bytes, transform);
+    }
+
+    return bytes;
+  }
+
+  std::vector<U8> Dataset::Tsc(U32 ObjectCount, U32 Seed)
+  {
+    std::mt19937 generator = std::mt19937{ Seed };
+    std::vector<U8> bytes = {};
+
+    Append(bytes, ObjectCount);
+
+    for (U32 i = 0; i < ObjectCount; i++)
+    {
+      ObjEntry entry = {};
+
+      entry.Id = (U8)generator();
+      entry.Category = (U8)(generator() % 8);
+      entry.Scale = U8V3{ 10, 10, 10 };
+      entry.Rotation = U8V3{ 0, (U8)generator(), 0 };
+      entry.Position = U16V3{ (U16)generator(), (U16)generator(), (U16)generator() };
+
+      Append(bytes, entry);
+    }
+
+    return bytes;
+  }
+
+  std::vector<U8> Dataset::Dds(U32 Size, U32 Seed)
+  {
+    // DXT1 with a full mip chain, the blocks themselves are noise
+
+    std::vector<U8> bytes = {};
+
+    U32 mipCount = 1;
+
+    while ((Size >> mipCount) > 0)
+    {
+      mipCount++;
+    }
+
+    dds_header header = {};
+
+    header.size = sizeof(dds_header);
+    header.flags = DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_MIPMAPCOUNT | DDSD_LINEARSIZE;
+    header.height = Size;
+    header.width = Size;
+    header.pitch_linear_size = std::max(1U, Size / 4) * std::max(1U, Size / 4) * 8;
+    header.mipmap_count = mipCount;
+    header.pixel_format.size = sizeof(dds_pixelformat);
+    header.pixel_format.flags = DDPF_FOURCC;
+    header.pixel_format.four_cc = 0x31545844;
+    header.caps = DDSCAPS_TEXTURE | DDSCAPS_MIPMAP | DDSCAPS_COMPLEX;
+
+    Append(bytes, (U32)0x20534444);
+    Append(bytes, header);
+
+    for (U32 i = 0; i < mipCount; i++)
+    {
+      U32 blocks = std::max(1U, (Size >> i) / 4);
+
+      std::vector<U8> mip = RandomBytes((U64)blocks * blocks * 8, Seed + i);
+
+      bytes.insert(bytes.end(), mip.begin(), mip.end());
+    }
+
+    return bytes;
+  }
+
+  std::vector<U8> Dataset::Level(const std::string& Name, const DatasetLevel& Level, U32 Seed)
+  {
+    std::mt19937 generator = std::mt19937{ Seed };
+    std::vector<DatasetEntry> entries = {};
+
+    entries.emplace_back(DatasetEntry{ "TSC", Name, Tsc(Level.ObjectCount, Seed + 1) });
+    entries.emplace_back(DatasetEntry{ "TRE", Name, Tsc(Level.ObjectCount / 4, Seed + 2) });
+    entries.emplace_back(DatasetEntry{ "TAT", Name, Tsc(Level.ObjectCount / 8, Seed + 3) });
+
+    // Models and textures sit in nested archives, the way level packages group them
+
+    std::vector<DatasetEntry> models = {};
+
+    for (U32 i = 0; i < Level.ModelCount; i++)
+    {
+      models.emplace_back(DatasetEntry{ "SCR", Name + "_" + std::to_string(i), Scr(Level.SubMeshCount, Level.DivisionCount, Level.VertexCount, Level.TextureCount, Seed + 100 + i) });
+    }
+
+    entries.emplace_back(DatasetEntry{ "DAT", Name + "_models", Archive(models) });
+
+    std::vector<DatasetEntry> textures = {};
+
+    for (U32 i = 0; i < Level.TextureCount; i++)
+    {
+      textures.emplace_back(DatasetEntry{ "DDS", Name + "_" + std::to_string(i), Dds(Level.TextureSize, Seed + 10000 + i) });
+    }
+
+    entries.emplace_back(DatasetEntry{ "DDP", Name, Archive(textures) });
+
+    // Filler sizes are spread logarithmically, most entries are small and a few are large
+
+    for (U32 i = 0; i < Level.FillerCount; i++)
+    {
+      U64 size = std::max<U64>(16, (U64)std::exp2(std::uniform_real_distribution<R64>{ 4.0, std::log2((R64)std::max<U64>(Level.FillerSize, 16)) }(generator)));
+
+      std::vector<U8> payload = RandomBytes(size, Seed + 20000 + i);
+
+      std::memset(payload.data(), 0, sizeof(U32));
+
+      entries.emplace_back(DatasetEntry{ sFillerTypes[generator() % sFillerTypeCount], Name + "_f" + std::to_string(i), std::move(payload) });
+    }
+
+    return Archive(entries);
+  }
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <Common/Types.h>
+
+///////////////////////////////////////////////////////////
+// Definition
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  struct DatasetEntry
+  {
+    std::string Type;
+    std::string Name;
+    std::vector<U8> Bytes;
+  };
+
+  struct DatasetLevel
+  {
+    U32 ModelCount = 32;
+    U32 SubMeshCount = 4;
+    U32 DivisionCount = 4;
+    U32 VertexCount = 256;
+    U32 ObjectCount = 256;
+    U32 TextureCount = 8;
+    U32 TextureSize = 256;
+    U32 FillerCount = 64;
+    U64 FillerSize = 16384;
+  };
+
+  /*
+   * Deterministic synthetic game data.
+   *
+   * Everything is built in memory from a seed, in the layouts the archive and asset
+   * parsers expect, so benchmarks and stress tests run without any game files.
+   */
+  class Dataset
+  {
+  public:
+
+    static std::vector<U8> RandomBytes(U64 Size, U32 Seed);
+
+  public:
+
+    static std::vector<U8> Archive(const std::vector<DatasetEntry>& Entries);
+    static std::vector<U8> NestedArchive(U32 OuterCount, U32 InnerCount, U64 FileSize, U32 Seed);
+
+  public:
+
+    static std::vector<U8> Scr(U32 SubMeshCount, U32 DivisionCount, U32 VertexCount, U32 TextureCount, U32 Seed);
+    static std::vector<U8> Tsc(U32 ObjectCount, U32 Seed);
+    static std::vector<U8> Dds(U32 Size, U32 Seed);
+
+  public:
+
+    static std::vector<U8> Level(const std::string& Name, const DatasetLevel& Level, U32 Seed);
+  };
+}
\ No newline at end of file
@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <filesystem>
+
+#include <Common/BlowFish.h>
+#include <Common/Debug.h>
+#include <Common/Types.h>
+
+#include <Common/Utils/FileUtils.h>
+
+#include <Generator/Dataset.h>
+
+#include <Vendor/rapidjson/rapidjson.h>
+#include <Vendor/rapidjson/document.h>
+#include <Vendor/rapidjson/prettywriter.h>
+#include <Vendor/rapidjson/stringbuffer.h>
+
+///////////////////////////////////////////////////////////
+// Namespaces
+///////////////////////////////////////////////////////////
+
+namespace fs = std::filesystem;
+namespace rj = rapidjson;
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+static constexpr const char* sRegions[] = { "0", "1", "2", "3", "c", "d", "e", "f" };
+static constexpr ark::U32 sRegionCount = sizeof(sRegions) / sizeof(sRegions[0]);
+
+static constexpr const char* sOptions[] = { "--output", "--regions", "--levels", "--scale", "--seed", "--key" };
+
+static void PrintUsage()
+{
+  LOG("Usage: Generator [options]\n");
+  LOG("\n");
+  LOG("Options:\n");
+  LOG("  --output <dir>      Output directory, defaults to Dataset\n");
+  LOG("  --regions <count>   Level regions, at most 8, defaults to 2\n");
+  LOG("  --levels <count>    Levels per region, defaults to 8\n");
+  LOG("  --scale <factor>    Multiplies models, objects, textures and filler files, defaults to 1\n");
+  LOG("  --seed <value>      Seed of all generated content, defaults to 1\n");
+  LOG("  --key <key>         Encryption key, defaults to the one of Packer.json\n");
+  LOG("\n");
+  LOG("Writes <output>/data_pc with encrypted level archives and a Config.json pointing at it.\n");
+}
+
+static void WriteConfig(const fs::path& OutputDir)
+{
+  rj::StringBuffer buffer;
+  rj::PrettyWriter<rj::StringBuffer> writer = rj::PrettyWriter<rj::StringBuffer>{ buffer };
+
+  writer.SetIndent(' ', 4);
+
+  writer.StartObject();
+  writer.Key("gameDir"); writer.String(OutputDir.generic_string().c_str());
+  writer.Key("unpackDir"); writer.String((OutputDir / "Unpack").generic_string().c_str());
+  writer.Key("repackDir"); writer.String((OutputDir / "Repack").generic_string().c_str());
+  writer.Key("optimizeMeshes"); writer.Bool(true);
+  writer.Key("textureBudget"); writer.Uint(512);
+  writer.Key("textureUploadBudget"); writer.Uint(8);
+  writer.EndObject();
+
+  ark::FileUtils::WriteText((OutputDir / "Config.json").string(), buffer.GetString());
+}
+
+///////////////////////////////////////////////////////////
+// Entry Point
+///////////////////////////////////////////////////////////
+
+ark::I32 main(ark::I32 Argc, char** Argv)
+{
+  fs::path outputDir = "Dataset";
+  std::string key = "YaKiNiKuM2rrVrPJpGMkfe3EK4RbpbHw";
+  ark::U32 regionCount = 2;
+  ark::U32 levelCount = 8;
+  ark::R64 scale = 1.0;
+  ark::U32 seed = 1;
+
+  for (ark::I32 i = 1; i < Argc; i++)
+  {
+    const char* option = Argv[i];
+    const char* value = ((i + 1) < Argc) ? Argv[i + 1] : nullptr;
+
+    if (std::strcmp(option, "--help") == 0)
+    {
+      PrintUsage();
+
+      return 0;
+    }
+
+    // Options are matched before their value is required, so unknown ones get the usage
+
+    if (std::none_of(std::begin(sOptions), std::end(sOptions), [&](const char* Name) { return std::strcmp(option, Name) == 0; }))
+    {
+      LOG("Unknown option %s\n", option);
+
+      PrintUsage();
+
+      return 2;
+    }
+
+    if (!value)
+    {
+      LOG("Missing value for %s\n", option);
+
+      return 2;
+    }
+
+    if (std::strcmp(option, "--output") == 0) outputDir = value;
+    else if (std::strcmp(option, "--regions") == 0) regionCount = std::min(sRegionCount, (ark::U32)std::strtoul(value, nullptr, 10));
+    else if (std::strcmp(option, "--levels") == 0) levelCount = std::min(256U, (ark::U32)std::strtoul(value, nullptr, 10));
+    else if (std::strcmp(option, "--scale") == 0) scale = std::max(0.0, std::strtod(value, nullptr));
+    else if (std::strcmp(option, "--seed") == 0) seed = (ark::U32)std::strtoul(value, nullptr, 10);
+    else if (std::strcmp(option, "--key") == 0) key = value;
+
+    i++;
+  }
+
+  // Entry counts scale linearly, archives stay below the table of contents limit of the archive parser
+
+  ark::DatasetLevel level = {};
+
+  auto scaled = [&](ark::U32 Count, ark::U32 Limit)
+  {
+    return std::clamp((ark::U32)(Count * scale), 1U, Limit);
+  };
+
+  level.ModelCount = scaled(level.ModelCount, 1024);
+  level.ObjectCount = scaled(level.ObjectCount, 65536);
+  level.TextureCount = scaled(level.TextureCount, 1024);
+  level.FillerCount = scaled(level.FillerCount, 2048);
+
+  ark::BlowFish cypher = { key };
+
+  ark::U64 totalSize = 0;
+
+  for (ark::U32 i = 0; i < regionCount; i++)
+  {
+    fs::path regionDir = outputDir / "data_pc" / (std::string{ "st" } + sRegions[i]);
+
+    fs::create_directories(regionDir);
+
+    for (ark::U32 j = 0; j < levelCount; j++)
+    {
+      char levelName[16] = {};
+
+      std::snprintf(levelName, sizeof(levelName), "r%s%02x", sRegions[i], j);
+
+      std::vector<ark::U8> bytes = ark::Dataset::Level(levelName, level, seed + i * 1000003 + j * 7919);
+
+      // Encryption works on whole blocks of eight bytes
+
+      bytes.resize((bytes.size() + 7) / 8 * 8, 0);
+
+      cypher.Encrypt(bytes);
+
+      ark::FileUtils::WriteBinary((regionDir / (std::string{ levelName } + ".dat")).string(), bytes);
+
+      totalSize += bytes.size();
+
+      LOG("Generated %s/%s.dat (%llu bytes)\n", regionDir.generic_string().c_str(), levelName, (unsigned long long)bytes.size());
+    }
+  }
+
+  WriteConfig(outputDir);
+
+  LOG("Generated %u levels (%llu bytes)\n", regionCount * levelCount, (unsigned long long)totalSize);
+
+  return 0;
+}
\ No newline at end of file
@@ -0,0 +1,195 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <thread>
+
+#include <Common/Debug.h>
+#include <Common/Packer.h>
+#include <Common/Types.h>
+
+#include <Common/Utils/FileUtils.h>
+
+#include <Vendor/rapidjson/rapidjson.h>
+#include <Vendor/rapidjson/document.h>
+#include <Vendor/rapidjson/writer.h>
+#include <Vendor/rapidjson/stringbuffer.h>
+
+///////////////////////////////////////////////////////////
+// Namespaces
+///////////////////////////////////////////////////////////
+
+namespace fs = std::filesystem;
+namespace rj = rapidjson;
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+static constexpr const char* sOptions[] = { "--config", "--packer", "--integrity", "--game-dir", "--unpack-dir", "--threads", "--filter" };
+
+static void PrintUsage()
+{
+  LOG("Usage: Packer <command> [options]\n");
+  LOG("\n");
+  LOG("Commands:\n");
+  LOG("  unpack            Decrypt and extract all configured sources\n");
+  LOG("  repack            Rebuild archives from unpacked sources\n");
+  LOG("  verify            Compare data files against the integrity map\n");
+  LOG("  gen-integrity     Write the integrity map of all data files\n");
+  LOG("\n");
+  LOG("Options:\n");
+  LOG("  --config <file>     Config file, defaults to Config.json\n");
+  LOG("  --packer <file>     Packer file, defaults to Packer.json\n");
+  LOG("  --integrity <file>  Integrity map, defaults to Integrity.json\n");
+  LOG("  --game-dir <dir>    Overrides gameDir of the config\n");
+  LOG("  --unpack-dir <dir>  Overrides unpackDir of the config\n");
+  LOG("  --threads <count>   Worker threads, defaults to hardware concurrency\n");
+  LOG("  --filter <text>     Only process files whose data path contains text\n");
+  LOG("\n");
+  LOG("Progress is written to stdout as one JSON object per line.\n");
+}
+
+static void PrintProgress(const ark::PackerProgress& Progress)
+{
+  rj::StringBuffer buffer;
+  rj::Writer<rj::StringBuffer> writer = rj::Writer<rj::StringBuffer>{ buffer };
+
+  writer.StartObject();
+  writer.Key("operation"); writer.String(Progress.Operation);
+  writer.Key("status"); writer.String(Progress.Status);
+  writer.Key("file"); writer.String(Progress.File.c_str());
+  writer.Key("index"); writer.Uint(Progress.Index);
+  writer.Key("count"); writer.Uint(Progress.Count);
+  writer.Key("crc32"); writer.Uint(Progress.Crc32);
+  writer.EndObject();
+
+  std::printf("%s\n", buffer.GetString());
+  std::fflush(stdout);
+}
+
+static void PrintResult(const char* Operation, ark::U32 Success)
+{
+  std::printf("{\"operation\":\"%s\",\"result\":\"%s\"}\n", Operation, (Success) ? "Ok" : "Failed");
+  std::fflush(stdout);
+}
+
+///////////////////////////////////////////////////////////
+// Entry Point
+///////////////////////////////////////////////////////////
+
+ark::I32 main(ark::I32 Argc, char** Argv)
+{
+  if (Argc < 2)
+  {
+    PrintUsage();
+
+    return 2;
+  }
+
+  std::string command = Argv[1];
+
+  if (command == "--help")
+  {
+    PrintUsage();
+
+    return 0;
+  }
+
+  std::string configFile = "Config.json";
+  std::string packerFile = "Packer.json";
+  std::string integrityFile = "Integrity.json";
+  std::string gameDir = {};
+  std::string unpackDir = {};
+  std::string filter = {};
+  ark::U32 threadCount = std::max(1U, std::thread::hardware_concurrency());
+
+  for (ark::I32 i = 2; i < Argc; i++)
+  {
+    const char* option = Argv[i];
+    const char* value = ((i + 1) < Argc) ? Argv[i + 1] : nullptr;
+
+    if (std::strcmp(option, "--help") == 0)
+    {
+      PrintUsage();
+
+      return 0;
+    }
+
+    // Options are matched before their value is required, so unknown ones get the usage
+
+    if (std::none_of(std::begin(sOptions), std::end(sOptions), [&](const char* Name) { return std::strcmp(option, Name) == 0; }))
+    {
+      LOG("Unknown option %s\n", option);
+
+      PrintUsage();
+
+      return 2;
+    }
+
+    if (!value)
+    {
+      LOG("Missing value for %s\n", option);
+
+      return 2;
+    }
+
+    if (std::strcmp(option, "--config") == 0) configFile = value;
+    else if (std::strcmp(option, "--packer") == 0) packerFile = value;
+    else if (std::strcmp(option, "--integrity") == 0) integrityFile = value;
+    else if (std::strcmp(option, "--game-dir") == 0) gameDir = value;
+    else if (std::strcmp(option, "--unpack-dir") == 0) unpackDir = value;
+    else if (std::strcmp(option, "--threads") == 0) threadCount = std::max(1UL, std::strtoul(value, nullptr, 10));
+    else if (std::strcmp(option, "--filter") == 0) filter = value;
+
+    i++;
+  }
+
+  rj::Document config = {};
+  rj::Document packer = {};
+
+  config.Parse(ark::FileUtils::ReadText(configFile).c_str());
+  packer.Parse(ark::FileUtils::ReadText(packerFile).c_str());
+
+  if (!config.IsObject() || !packer.IsObject())
+  {
+    LOG("Failed reading %s or %s\n", configFile.c_str(), packerFile.c_str());
+
+    return 2;
+  }
+
+  if (!gameDir.empty())
+  {
+    config["gameDir"].SetString(gameDir.c_str(), config.GetAllocator());
+  }
+
+  if (!unpackDir.empty())
+  {
+    config["unpackDir"].SetString(unpackDir.c_str(), config.GetAllocator());
+  }
+
+  ark::PackerOptions options = ark::Packer::FromConfig(config, packer);
+
+  options.IntegrityFile = integrityFile;
+  options.ThreadCount = threadCount;
+  options.Filter = filter;
+  options.Progress = PrintProgress;
+
+  ark::U32 success = 0;
+
+  if (command == "unpack") success = ark::Packer::Unpack(options);
+  else if (command == "repack") success = ark::Packer::Repack(options);
+  else if (command == "verify") success = ark::Packer::CheckIntegrity(options);
+  else if (command == "gen-integrity") success = ark::Packer::GenerateIntegrityMap(options);
+  else
+  {
+    PrintUsage();
+
+    return 2;
+  }
+
+  PrintResult(command.c_str(), success);
+
+  return (success) ? 0 : 1;
+}
\ No newline at end of file
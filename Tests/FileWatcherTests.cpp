@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <filesystem>
+#include <vector>
+
+#include <Common/FileWatcher.h>
+
+#include <Common/Utils/FileUtils.h>
+
+#include <Tests/Test.h>
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static fs::path GetWatchDir(const std::string& Name)
+  {
+    fs::path dir = fs::temp_directory_path() / "NipponTests" / Name;
+
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    return dir;
+  }
+
+  static U32 HasEvent(const std::vector<FileEvent>& Events, FileEventType Type, const fs::path& File)
+  {
+    return std::any_of(Events.begin(), Events.end(), [&](const FileEvent& Event) { return Event.Type == Type && Event.File == File; });
+  }
+}
+
+///////////////////////////////////////////////////////////
+// Tests
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static Test sFileWatcherWatch = { "FileWatcher::Watch/Directories", [](TestState& State)
+  {
+    fs::path dir = GetWatchDir("FileWatcher");
+
+    fs::create_directories(dir / "a" / "b");
+
+    FileWatcher fileWatcher = { dir };
+
+    if (!fileWatcher.IsOpen())
+    {
+      return;
+    }
+
+    // Directories below the root are only reported once watched themselves
+
+    FileUtils::WriteBinary((dir / "a" / "unwatched.bin").string(), { 1 });
+
+    TEST_CHECK(State, fileWatcher.Poll().empty());
+    TEST_CHECK(State, fileWatcher.Watch(dir / "a"));
+
+    FileUtils::WriteBinary((dir / "a" / "watched.bin").string(), { 1 });
+
+    std::vector<FileEvent> events = fileWatcher.Poll();
+
+    TEST_CHECK(State, HasEvent(events, eFileEventCreated, dir / "a" / "watched.bin"));
+    TEST_CHECK(State, HasEvent(events, eFileEventModified, dir / "a" / "watched.bin"));
+
+    fileWatcher.Unwatch(dir / "a");
+
+    FileUtils::WriteBinary((dir / "a" / "unwatched.bin").string(), { 2 });
+
+    TEST_CHECK(State, fileWatcher.Poll().empty());
+
+    fs::remove_all(dir);
+  } };
+
+  static Test sFileWatcherMove = { "FileWatcher::Poll/MovedDirectory", [](TestState& State)
+  {
+    fs::path dir = GetWatchDir("FileWatcherMove");
+
+    fs::create_directories(dir / "a" / "b");
+
+    FileWatcher fileWatcher = { dir };
+
+    if (!fileWatcher.IsOpen())
+    {
+      return;
+    }
+
+    fileWatcher.Watch(dir / "a");
+    fileWatcher.Watch(dir / "a" / "b");
+
+    fs::rename(dir / "a", dir / "c");
+
+    std::vector<FileEvent> events = fileWatcher.Poll();
+
+    TEST_CHECK(State, HasEvent(events, eFileEventDeleted, dir / "a"));
+    TEST_CHECK(State, HasEvent(events, eFileEventCreated, dir / "c"));
+
+    // Watches of the moved directory are dropped instead of reporting under the old path
+
+    FileUtils::WriteBinary((dir / "c" / "b" / "moved.bin").string(), { 1 });
+
+    TEST_CHECK(State, fileWatcher.Poll().empty());
+
+    fs::remove_all(dir);
+  } };
+}
\ No newline at end of file
@@ -0,0 +1,146 @@
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <Common/JobSystem.h>
+
+#include <Tests/Test.h>
+
+///////////////////////////////////////////////////////////
+// Tests
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static Test sJobSystemDependencies = { "JobSystem::Schedule/Dependencies", [](TestState& State)
+  {
+    JobSystem::Initialize(4);
+
+    std::mutex mutex = {};
+    std::vector<U32> order = {};
+
+    auto record = [&](U32 Value)
+    {
+      std::lock_guard<std::mutex> lock{ mutex };
+
+      order.emplace_back(Value);
+    };
+
+    JobHandle first = JobSystem::Schedule([&]() { std::this_thread::sleep_for(std::chrono::milliseconds(5)); record(1); });
+    JobHandle second = JobSystem::Schedule([&]() { record(2); }, { first });
+    JobHandle third = JobSystem::Then(second, [&]() { record(3); });
+
+    JobSystem::Wait(third);
+
+    TEST_CHECK(State, first->IsFinished() && second->IsFinished());
+    TEST_CHECK(State, order == std::vector<U32>({ 1, 2, 3 }));
+
+    // A join waits for every branch of a fan out
+
+    std::atomic<U32> branches = 0;
+    std::atomic<U32> branchesAtJoin = 0;
+    std::vector<JobHandle> fanOut = {};
+
+    JobHandle root = JobSystem::Schedule([]() {});
+
+    for (U32 i = 0; i < 32; i++)
+    {
+      fanOut.emplace_back(JobSystem::Then(root, [&]() { branches++; }));
+    }
+
+    JobHandle join = JobSystem::Schedule([&]() { branchesAtJoin = branches.load(); }, fanOut);
+
+    JobSystem::Wait(join);
+
+    TEST_CHECK(State, branchesAtJoin == 32);
+  } };
+
+  static Test sJobSystemCancellation = { "JobSystem::Schedule/Cancellation", [](TestState& State)
+  {
+    CancellationToken token = {};
+
+    token.Cancel();
+
+    std::atomic<U32> cancelledRuns = 0;
+    std::atomic<U32> continuationRuns = 0;
+
+    JobHandle cancelled = JobSystem::Schedule([&]() { cancelledRuns++; }, {}, eJobAffinityAny, &token);
+    JobHandle continuation = JobSystem::Then(cancelled, [&]() { continuationRuns++; });
+
+    JobSystem::Wait(continuation);
+
+    TEST_CHECK(State, cancelled->IsFinished());
+    TEST_CHECK(State, cancelledRuns == 0);
+    TEST_CHECK(State, continuationRuns == 1);
+
+    std::atomic<U64> sum = 0;
+    JobCounter counter = {};
+
+    TEST_CHECK(State, JobSystem::ParallelFor(10000, [&](U32 Index) { sum += Index; }, ParallelForOptions{ 64, 0, nullptr, &counter }) == 1);
+    TEST_CHECK(State, sum == 49995000);
+    TEST_CHECK(State, counter.IsDone() && counter.GetCompleted() == 10000);
+
+    std::atomic<U32> cancelledItems = 0;
+
+    TEST_CHECK(State, JobSystem::ParallelFor(10000, [&](U32) { cancelledItems++; }, ParallelForOptions{ 64, 0, &token, nullptr }) == 0);
+    TEST_CHECK(State, cancelledItems == 0);
+  } };
+
+  static Test sJobSystemMainAffinity = { "JobSystem::Schedule/MainAffinity", [](TestState& State)
+  {
+    std::thread::id mainThread = std::this_thread::get_id();
+    std::thread::id ranOn = {};
+
+    JobHandle job = JobSystem::Schedule([&]() { ranOn = std::this_thread::get_id(); }, {}, eJobAffinityMain);
+
+    // Workers never pick up main thread jobs, they wait for the main thread
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    TEST_CHECK(State, !job->IsFinished());
+    TEST_CHECK(State, JobSystem::RunMainThreadJobs() == 1);
+    TEST_CHECK(State, job->IsFinished() && ranOn == mainThread);
+  } };
+
+  static Test sJobSystemShutdown = { "JobSystem::Shutdown/QueuedJobs", [](TestState& State)
+  {
+    // Children scheduled on a worker land in its own queue, those still queued at
+    // shutdown must be found by the waiting thread afterwards
+
+    std::mutex mutex = {};
+    std::vector<JobHandle> children = {};
+    std::atomic<U32> childRuns = 0;
+
+    JobHandle parent = JobSystem::Schedule([&]()
+    {
+      for (U32 i = 0; i < 128; i++)
+      {
+        JobHandle child = JobSystem::Schedule([&]() { std::this_thread::sleep_for(std::chrono::microseconds(500)); childRuns++; });
+
+        std::lock_guard<std::mutex> lock{ mutex };
+
+        children.emplace_back(child);
+      }
+    });
+
+    // Give a worker the chance to pick up the parent before this thread runs it while waiting
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    JobSystem::Wait(parent);
+    JobSystem::Shutdown();
+    JobSystem::WaitAll(children);
+
+    TEST_CHECK(State, childRuns == 128);
+
+    // Jobs scheduled after the shutdown are run by the waiting thread
+
+    JobHandle late = JobSystem::Schedule([&]() { childRuns++; });
+
+    JobSystem::Wait(late);
+
+    TEST_CHECK(State, childRuns == 129);
+  } };
+}
\ No newline at end of file
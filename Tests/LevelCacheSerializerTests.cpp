@@ -0,0 +1,303 @@
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <memory_resource>
+
+#include <Common/Utils/FileUtils.h>
+
+#include <Generator/Dataset.h>
+
+#include <Tests/Test.h>
+
+#include <Editor/Vertex.h>
+
+#include <Editor/Assets/Model.h>
+#include <Editor/Assets/Object.h>
+
+#include <Editor/Serializer/LevelCacheSerializer.h>
+#include <Editor/Serializer/ModelSerializer.h>
+#include <Editor/Serializer/ObjectSerializer.h>
+
+///////////////////////////////////////////////////////////
+// Namespaces
+///////////////////////////////////////////////////////////
+
+namespace fs = std::filesystem;
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static constexpr U32 sFlags = 1;
+
+  static const std::vector<LevelCacheSource> sSources = { LevelCacheSource{ 0x11111111, 0x22222222 }, LevelCacheSource{ 0x33333333, 0x44444444 } };
+
+  static fs::path GetCacheFile(const std::string& Name)
+  {
+    fs::path dir = fs::temp_directory_path() / "NipponTests";
+
+    fs::create_directories(dir);
+
+    return dir / (Name + ".cache");
+  }
+
+  static void BuildLevel(std::pmr::memory_resource* Resource, std::vector<Object>& Objects, std::vector<ModelGroup>& ModelGroups)
+  {
+    ObjectSerializer objectSerializer = { Dataset::Tsc(24, 1) };
+
+    Objects = objectSerializer.GetObjects();
+
+    for (U32 i = 0; i < 3; i++)
+    {
+      ModelSerializer modelSerializer = { Resource, "r10" + std::to_string(i), Dataset::Scr(2 + i, 3, 40, 4, 10 + i), 0 };
+
+      ModelGroups.emplace_back(std::move(modelSerializer.GetModelGroup()));
+    }
+  }
+
+  static bool Equal(const Object& A, const Object& B)
+  {
+    return A.GetId() == B.GetId() && A.GetCategory() == B.GetCategory() && A.GetPosition() == B.GetPosition() && A.GetRotation() == B.GetRotation() && A.GetScale() == B.GetScale();
+  }
+
+  static bool Equal(const ModelDivision& A, const ModelDivision& B)
+  {
+    return A.GetTextureIndex() == B.GetTextureIndex()
+      && A.GetVertexCount() == B.GetVertexCount()
+      && A.GetElementCount() == B.GetElementCount()
+      && std::memcmp(A.GetVertexBuffer().data(), B.GetVertexBuffer().data(), A.GetVertexCount() * sizeof(DefaultVertex)) == 0
+      && std::memcmp(A.GetElementBuffer().data(), B.GetElementBuffer().data(), A.GetElementCount() * sizeof(U16)) == 0;
+  }
+
+  static bool Equal(const ModelEntry& A, const ModelEntry& B)
+  {
+    if (A.GetId() != B.GetId() || A.GetType() != B.GetType() || A.GetPosition() != B.GetPosition() || A.GetRotation() != B.GetRotation() || A.GetScale() != B.GetScale() || A.GetDivisionCount() != B.GetDivisionCount())
+    {
+      return false;
+    }
+
+    for (U64 i = 0; i < A.GetDivisionCount(); i++)
+    {
+      if (!Equal(A[i], B[i]))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  static bool Equal(const ModelGroup& A, const ModelGroup& B)
+  {
+    if (A.GetName() != B.GetName() || A.GetEntryCount() != B.GetEntryCount())
+    {
+      return false;
+    }
+
+    for (U64 i = 0; i < A.GetEntryCount(); i++)
+    {
+      if (!Equal(A[i], B[i]))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  static U32 LoadFrom(const fs::path& File, U32 Flags, const std::vector<LevelCacheSource>& Sources, U64& LoadedCount)
+  {
+    std::pmr::monotonic_buffer_resource arena = {};
+
+    std::vector<Object> objects = {};
+    std::vector<ModelGroup> modelGroups = {};
+
+    U32 loaded = LevelCacheSerializer::Load(&arena, File, Flags, Sources, objects, modelGroups);
+
+    LoadedCount = objects.size() + modelGroups.size();
+
+    return loaded;
+  }
+
+  static U32 LoadCorrupted(const std::vector<U8>& Bytes, U64 Offset, U32 Value)
+  {
+    fs::path file = GetCacheFile("Corrupted");
+
+    std::vector<U8> bytes = Bytes;
+
+    std::memcpy(&bytes[Offset], &Value, sizeof(U32));
+
+    FileUtils::WriteBinary(file.string(), bytes);
+
+    U64 loadedCount = 0;
+    U32 loaded = LoadFrom(file, sFlags, sSources, loadedCount);
+
+    fs::remove(file);
+
+    return loaded || loadedCount;
+  }
+}
+
+///////////////////////////////////////////////////////////
+// Tests
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static Test sLevelCacheRoundTrip = { "LevelCacheSerializer::Load/RoundTrip", [](TestState& State)
+  {
+    std::pmr::monotonic_buffer_resource arena = {};
+
+    std::vector<Object> objects = {};
+    std::vector<ModelGroup> modelGroups = {};
+
+    BuildLevel(&arena, objects, modelGroups);
+
+    fs::path file = GetCacheFile("RoundTrip");
+    fs::path partialFile = file;
+    partialFile += ".partial";
+
+    TEST_CHECK(State, LevelCacheSerializer::Save(file, sFlags, sSources, objects, modelGroups) == 1);
+    TEST_CHECK(State, fs::exists(file));
+    TEST_CHECK(State, !fs::exists(partialFile));
+
+    std::pmr::monotonic_buffer_resource loadArena = {};
+
+    std::vector<Object> loadedObjects = {};
+    std::vector<ModelGroup> loadedModelGroups = {};
+
+    TEST_CHECK(State, LevelCacheSerializer::Load(&loadArena, file, sFlags, sSources, loadedObjects, loadedModelGroups) == 1);
+
+    if (TEST_CHECK(State, loadedObjects.size() == objects.size()))
+    {
+      for (U64 i = 0; i < objects.size(); i++)
+      {
+        TEST_CHECK(State, Equal(loadedObjects[i], objects[i]));
+      }
+    }
+
+    if (TEST_CHECK(State, loadedModelGroups.size() == modelGroups.size()))
+    {
+      for (U64 i = 0; i < modelGroups.size(); i++)
+      {
+        TEST_CHECK(State, Equal(loadedModelGroups[i], modelGroups[i]));
+      }
+    }
+
+    fs::remove(file);
+  } };
+
+  static Test sLevelCacheMismatch = { "LevelCacheSerializer::Load/Mismatch", [](TestState& State)
+  {
+    std::pmr::monotonic_buffer_resource arena = {};
+
+    std::vector<Object> objects = {};
+    std::vector<ModelGroup> modelGroups = {};
+
+    BuildLevel(&arena, objects, modelGroups);
+
+    fs::path file = GetCacheFile("Mismatch");
+
+    LevelCacheSerializer::Save(file, sFlags, sSources, objects, modelGroups);
+
+    std::vector<LevelCacheSource> changedSources = sSources;
+    std::vector<LevelCacheSource> fewerSources = { sSources[0] };
+
+    changedSources[1].DataCrc++;
+
+    U64 loadedCount = 0;
+
+    TEST_CHECK(State, LoadFrom(file, sFlags + 1, sSources, loadedCount) == 0 && loadedCount == 0);
+    TEST_CHECK(State, LoadFrom(file, sFlags, changedSources, loadedCount) == 0 && loadedCount == 0);
+    TEST_CHECK(State, LoadFrom(file, sFlags, fewerSources, loadedCount) == 0 && loadedCount == 0);
+    TEST_CHECK(State, LoadFrom(GetCacheFile("Missing"), sFlags, sSources, loadedCount) == 0 && loadedCount == 0);
+
+    fs::remove(file);
+  } };
+
+  static Test sLevelCacheTruncated = { "LevelCacheSerializer::Load/Truncated", [](TestState& State)
+  {
+    std::pmr::monotonic_buffer_resource arena = {};
+
+    std::vector<Object> objects = {};
+    std::vector<ModelGroup> modelGroups = {};
+
+    BuildLevel(&arena, objects, modelGroups);
+
+    fs::path file = GetCacheFile("Truncated");
+
+    LevelCacheSerializer::Save(file, sFlags, sSources, objects, modelGroups);
+
+    std::vector<U8> bytes = FileUtils::ReadBinary(file.string());
+
+    LevelCacheHeader header = {};
+
+    std::memcpy(&header, bytes.data(), sizeof(LevelCacheHeader));
+
+    // Cut the file inside every section, none of them may be read past the end
+
+    for (U64 size : std::vector<U64>{ 0, sizeof(LevelCacheHeader) - 1, sizeof(LevelCacheHeader) + 4, header.StringOffset, header.VertexOffset + 8, header.ElementOffset, bytes.size() - 2 })
+    {
+      FileUtils::WriteBinary(file.string(), bytes);
+
+      fs::resize_file(file, size);
+
+      U64 loadedCount = 0;
+
+      TEST_CHECK(State, LoadFrom(file, sFlags, sSources, loadedCount) == 0 && loadedCount == 0);
+    }
+
+    fs::remove(file);
+  } };
+
+  static Test sLevelCacheCorrupted = { "LevelCacheSerializer::Load/Corrupted", [](TestState& State)
+  {
+    std::pmr::monotonic_buffer_resource arena = {};
+
+    std::vector<Object> objects = {};
+    std::vector<ModelGroup> modelGroups = {};
+
+    BuildLevel(&arena, objects, modelGroups);
+
+    fs::path file = GetCacheFile("Corrupted");
+
+    LevelCacheSerializer::Save(file, sFlags, sSources, objects, modelGroups);
+
+    std::vector<U8> bytes = FileUtils::ReadBinary(file.string());
+
+    fs::remove(file);
+
+    LevelCacheHeader header = {};
+
+    std::memcpy(&header, bytes.data(), sizeof(LevelCacheHeader));
+
+    U64 groupOffset = sizeof(LevelCacheHeader) + header.SourceCount * sizeof(LevelCacheSource) + header.ObjectCount * sizeof(LevelCacheObject);
+    U64 entryOffset = groupOffset + header.GroupCount * sizeof(LevelCacheGroup);
+    U64 divisionOffset = entryOffset + header.EntryCount * sizeof(LevelCacheEntry);
+
+    LevelCacheGroup group = {};
+    LevelCacheEntry entry = {};
+    LevelCacheDivision division = {};
+
+    std::memcpy(&group, &bytes[groupOffset], sizeof(LevelCacheGroup));
+    std::memcpy(&entry, &bytes[entryOffset], sizeof(LevelCacheEntry));
+    std::memcpy(&division, &bytes[divisionOffset], sizeof(LevelCacheDivision));
+
+    TEST_CHECK(State, LoadCorrupted(bytes, 0, LevelCacheSerializer::sCacheId) == 1);
+
+    TEST_CHECK(State, LoadCorrupted(bytes, offsetof(LevelCacheHeader, ObjectCount), header.ObjectCount + 1) == 0);
+    TEST_CHECK(State, LoadCorrupted(bytes, offsetof(LevelCacheHeader, GroupCount), 0xFFFFFFFF) == 0);
+    TEST_CHECK(State, LoadCorrupted(bytes, offsetof(LevelCacheHeader, DivisionCount), header.DivisionCount - 1) == 0);
+    TEST_CHECK(State, LoadCorrupted(bytes, offsetof(LevelCacheHeader, StringOffset), (U32)header.StringOffset + 1) == 0);
+    TEST_CHECK(State, LoadCorrupted(bytes, offsetof(LevelCacheHeader, VertexSize), (U32)header.VertexSize + sizeof(DefaultVertex)) == 0);
+    TEST_CHECK(State, LoadCorrupted(bytes, offsetof(LevelCacheHeader, ElementSize), (U32)header.ElementSize - sizeof(U16)) == 0);
+
+    TEST_CHECK(State, LoadCorrupted(bytes, groupOffset + offsetof(LevelCacheGroup, NameSize), 0x10000) == 0);
+    TEST_CHECK(State, LoadCorrupted(bytes, groupOffset + offsetof(LevelCacheGroup, EntryCount), group.EntryCount + 1) == 0);
+    TEST_CHECK(State, LoadCorrupted(bytes, entryOffset + offsetof(LevelCacheEntry, DivisionCount), entry.DivisionCount + 1) == 0);
+    TEST_CHECK(State, LoadCorrupted(bytes, divisionOffset + offsetof(LevelCacheDivision, VertexCount), division.VertexCount + 1) == 0);
+    TEST_CHECK(State, LoadCorrupted(bytes, divisionOffset + offsetof(LevelCacheDivision, ElementCount), 0xFFFFFFFF) == 0);
+  } };
+}
\ No newline at end of file
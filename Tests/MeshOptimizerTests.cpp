@@ -0,0 +1,223 @@
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include <Generator/Dataset.h>
+
+#include <Tests/Test.h>
+
+#include <Editor/Vertex.h>
+
+#include <Editor/Assets/Model.h>
+
+#include <Editor/Optimizer/MeshOptimizer.h>
+
+#include <Editor/Serializer/ModelSerializer.h>
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  using TestTriangle = std::array<std::string, 3>;
+
+  static std::vector<U16> Triangulate(const std::vector<U16>& Strips)
+  {
+    std::vector<U16> triangles = {};
+
+    U64 stripStart = 0;
+
+    for (U64 i = 0; i <= Strips.size(); i++)
+    {
+      if (i < Strips.size() && Strips[i] != MeshOptimizer::sRestartIndex)
+      {
+        continue;
+      }
+
+      for (U64 j = stripStart; (j + 2) < i; j++)
+      {
+        if (Strips[j] != Strips[j + 1] && Strips[j + 1] != Strips[j + 2] && Strips[j] != Strips[j + 2])
+        {
+          triangles.insert(triangles.end(), { Strips[j], Strips[j + 1], Strips[j + 2] });
+        }
+      }
+
+      stripStart = i + 1;
+    }
+
+    return triangles;
+  }
+
+  static std::vector<TestTriangle> GetTriangles(const ModelDivision& ModelDivision)
+  {
+    // Triangles are compared by vertex contents in any winding, the optimizer merges vertices, drops
+    // the strip connection flags and does not keep winding
+
+    std::vector<U16> triangles = Triangulate({ ModelDivision.GetElementBuffer().begin(), ModelDivision.GetElementBuffer().end() });
+    std::vector<TestTriangle> result = {};
+
+    for (U64 i = 0; i < triangles.size(); i += 3)
+    {
+      TestTriangle triangle = {};
+
+      for (U32 j = 0; j < 3; j++)
+      {
+        DefaultVertex vertex = ModelDivision.GetVertexBuffer()[triangles[i + j]];
+
+        vertex.Connection = 0;
+
+        triangle[j].assign((const char*)&vertex, sizeof(DefaultVertex));
+      }
+
+      std::sort(triangle.begin(), triangle.end());
+
+      result.emplace_back(triangle);
+    }
+
+    std::sort(result.begin(), result.end());
+
+    return result;
+  }
+
+  static R32 GetAverageCacheMissRatio(const ModelDivision& ModelDivision)
+  {
+    std::vector<U16> triangles = Triangulate({ ModelDivision.GetElementBuffer().begin(), ModelDivision.GetElementBuffer().end() });
+    std::deque<U16> cache = {};
+
+    U32 misses = 0;
+
+    for (U16 index : triangles)
+    {
+      if (std::find(cache.begin(), cache.end(), index) == cache.end())
+      {
+        misses++;
+
+        cache.emplace_back(index);
+
+        if (cache.size() > MeshOptimizer::sCacheSize)
+        {
+          cache.pop_front();
+        }
+      }
+    }
+
+    return triangles.empty() ? 0.0F : (R32)misses / (R32)(triangles.size() / 3);
+  }
+
+  static void BuildGrid(ModelDivision& ModelDivision, U32 Size)
+  {
+    // Row by row strips, each row reloads the vertices of the previous one once the cache is too small for two rows
+
+    ModelDivision.ResizeVertices((U64)Size * Size);
+
+    for (U32 z = 0; z < Size; z++)
+    {
+      for (U32 x = 0; x < Size; x++)
+      {
+        ModelDivision.GetVertexBuffer()[z * Size + x].Position = I16V3{ (I16)x, 0, (I16)z };
+      }
+    }
+
+    for (U32 z = 0; (z + 1) < Size; z++)
+    {
+      if (z)
+      {
+        ModelDivision.AddElement(MeshOptimizer::sRestartIndex);
+      }
+
+      for (U32 x = 0; x < Size; x++)
+      {
+        ModelDivision.AddElement((U16)(z * Size + x));
+        ModelDivision.AddElement((U16)((z + 1) * Size + x));
+      }
+    }
+  }
+}
+
+///////////////////////////////////////////////////////////
+// Tests
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static Test sMeshOptimizerGrid = { "MeshOptimizer::Optimize/Grid", [](TestState& State)
+  {
+    ModelDivision modelDivision = {};
+
+    BuildGrid(modelDivision, 40);
+
+    std::vector<TestTriangle> triangles = GetTriangles(modelDivision);
+    R32 missRatio = GetAverageCacheMissRatio(modelDivision);
+
+    MeshOptimizer::Optimize(modelDivision);
+
+    TEST_CHECK(State, GetTriangles(modelDivision) == triangles);
+    TEST_CHECK(State, modelDivision.GetVertexCount() == 40 * 40);
+    TEST_CHECK(State, GetAverageCacheMissRatio(modelDivision) < missRatio);
+
+    // Vertices are ordered by first use
+
+    std::vector<U16> optimized = Triangulate({ modelDivision.GetElementBuffer().begin(), modelDivision.GetElementBuffer().end() });
+
+    U32 nextVertex = 0;
+    U32 ordered = 1;
+
+    for (U16 index : optimized)
+    {
+      if (index == nextVertex)
+      {
+        nextVertex++;
+      }
+      else if (index > nextVertex)
+      {
+        ordered = 0;
+      }
+    }
+
+    TEST_CHECK(State, ordered && nextVertex == modelDivision.GetVertexCount());
+  } };
+
+  static Test sMeshOptimizerDuplicates = { "MeshOptimizer::Optimize/Duplicates", [](TestState& State)
+  {
+    std::pmr::monotonic_buffer_resource arena = {};
+
+    ModelSerializer modelSerializer = { &arena, "r100", Dataset::Scr(2, 2, 64, 4, 31), 0 };
+
+    for (auto& modelEntry : modelSerializer.GetModelGroup())
+    {
+      for (auto& modelDivision : modelEntry)
+      {
+        // Every vertex appended a second time must be merged back into the first
+
+        U64 vertexCount = modelDivision.GetVertexCount();
+
+        std::vector<DefaultVertex> vertices = { modelDivision.GetVertexBuffer().begin(), modelDivision.GetVertexBuffer().end() };
+        std::vector<U16> elements = { modelDivision.GetElementBuffer().begin(), modelDivision.GetElementBuffer().end() };
+
+        vertices.insert(vertices.end(), modelDivision.GetVertexBuffer().begin(), modelDivision.GetVertexBuffer().end());
+
+        for (auto& element : elements)
+        {
+          if (element != MeshOptimizer::sRestartIndex && (element & 1))
+          {
+            element = (U16)(element + vertexCount);
+          }
+        }
+
+        modelDivision.SetVertexBuffer(vertices.data(), vertices.size());
+        modelDivision.SetElementBuffer(elements.data(), elements.size());
+
+        std::vector<TestTriangle> triangles = GetTriangles(modelDivision);
+
+        MeshOptimizer::Optimize(modelDivision);
+
+        TEST_CHECK(State, GetTriangles(modelDivision) == triangles);
+        TEST_CHECK(State, modelDivision.GetVertexCount() <= vertexCount);
+      }
+    }
+  } };
+}
\ No newline at end of file
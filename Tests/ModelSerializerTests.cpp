@@ -0,0 +1,91 @@
+#include <memory_resource>
+
+#include <Generator/Dataset.h>
+
+#include <Tests/Test.h>
+
+#include <Editor/Vertex.h>
+
+#include <Editor/Assets/Model.h>
+
+#include <Editor/Serializer/ModelSerializer.h>
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static constexpr U32 sSubMeshCount = 4;
+  static constexpr U32 sDivisionCount = 3;
+  static constexpr U32 sVertexCount = 40;
+
+  static void CheckModelGroup(TestState& State, const ModelGroup& ModelGroup)
+  {
+    if (!TEST_CHECK(State, ModelGroup.GetEntryCount() == sSubMeshCount))
+    {
+      return;
+    }
+
+    for (U32 i = 0; i < sSubMeshCount; i++)
+    {
+      const ModelEntry& modelEntry = ModelGroup[i];
+
+      // Every submesh carries its own index as mesh id and sits on the ground with unit scale
+
+      TEST_CHECK(State, modelEntry.GetId() == i);
+      TEST_CHECK(State, modelEntry.GetType() == 0x20);
+      TEST_CHECK(State, modelEntry.GetPosition().y == 0.0F);
+      TEST_CHECK(State, modelEntry.GetScale() == R32V3(4096.0F));
+
+      if (!TEST_CHECK(State, modelEntry.GetDivisionCount() == sDivisionCount))
+      {
+        continue;
+      }
+
+      for (const auto& modelDivision : modelEntry)
+      {
+        U32 validVertices = 0;
+
+        for (const auto& vertex : modelDivision.GetVertexBuffer())
+        {
+          validVertices += vertex.TextureMap == U16V2(1000)
+            && vertex.Position.x >= 0 && vertex.Position.x < 2048
+            && vertex.Position.y >= 0 && vertex.Position.y < 2048
+            && vertex.Position.z >= 0 && vertex.Position.z < 2048;
+        }
+
+        TEST_CHECK(State, modelDivision.GetVertexCount() == sVertexCount);
+        TEST_CHECK(State, validVertices == modelDivision.GetVertexCount());
+        TEST_CHECK(State, modelDivision.GetElementCount() > 0);
+      }
+    }
+  }
+}
+
+///////////////////////////////////////////////////////////
+// Tests
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static Test sModelSerializerDivisions = { "ModelSerializer::ModelSerializer/Divisions", [](TestState& State)
+  {
+    std::pmr::monotonic_buffer_resource arena = {};
+
+    ModelSerializer modelSerializer = { &arena, "r100", Dataset::Scr(sSubMeshCount, sDivisionCount, sVertexCount, 4, 21), 0 };
+
+    TEST_CHECK(State, modelSerializer.GetModelGroup().GetName() == "r100");
+
+    CheckModelGroup(State, modelSerializer.GetModelGroup());
+  } };
+
+  static Test sModelSerializerDivisionsOptimized = { "ModelSerializer::ModelSerializer/DivisionsOptimized", [](TestState& State)
+  {
+    std::pmr::monotonic_buffer_resource arena = {};
+
+    ModelSerializer modelSerializer = { &arena, "r100", Dataset::Scr(sSubMeshCount, sDivisionCount, sVertexCount, 4, 21), 1 };
+
+    CheckModelGroup(State, modelSerializer.GetModelGroup());
+  } };
+}
\ No newline at end of file
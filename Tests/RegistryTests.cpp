@@ -0,0 +1,154 @@
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include <Editor/Registry.h>
+
+#include <Tests/Test.h>
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  struct TestPosition
+  {
+    static constexpr ComponentType Type = eComponentTypeTransform;
+
+    U32 Value = 0;
+  };
+
+  struct TestName
+  {
+    static constexpr ComponentType Type = eComponentTypeCamera;
+
+    std::string Value = {};
+  };
+}
+
+///////////////////////////////////////////////////////////
+// Tests
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static Test sRegistryGenerations = { "Registry::CreateEntity/Generations", [](TestState& State)
+  {
+    Registry registry = {};
+
+    Entity first = registry.CreateEntity();
+    Entity second = registry.CreateEntity();
+
+    registry.Emplace<TestPosition>(first, 1U);
+
+    TEST_CHECK(State, registry.IsAlive(first) && registry.IsAlive(second));
+    TEST_CHECK(State, !(first == second));
+
+    registry.DestroyEntity(first);
+
+    // The index is recycled, handles to the destroyed entity stay dead
+
+    Entity reused = registry.CreateEntity();
+
+    TEST_CHECK(State, reused.Index == first.Index);
+    TEST_CHECK(State, reused.Generation == first.Generation + 1);
+    TEST_CHECK(State, !registry.IsAlive(first));
+    TEST_CHECK(State, registry.IsAlive(reused));
+    TEST_CHECK(State, registry.Get<TestPosition>(first) == nullptr);
+    TEST_CHECK(State, registry.Get<TestPosition>(reused) == nullptr);
+
+    registry.Emplace<TestPosition>(reused, 2U);
+    registry.Remove<TestPosition>(first);
+
+    TEST_CHECK(State, registry.Get<TestPosition>(reused) && registry.Get<TestPosition>(reused)->Value == 2);
+
+    registry.DestroyEntity(first);
+
+    TEST_CHECK(State, registry.IsAlive(reused));
+  } };
+
+  static Test sRegistryPooling = { "Registry::Emplace/Pooling", [](TestState& State)
+  {
+    std::pmr::monotonic_buffer_resource arena = {};
+
+    Registry registry = { &arena };
+
+    std::vector<Entity> entities = {};
+
+    for (U32 i = 0; i < 3000; i++)
+    {
+      entities.emplace_back(registry.CreateEntity());
+    }
+
+    TestName* firstName = registry.Emplace<TestName>(entities[0], "entity0");
+
+    // Components live in pages, growing past a page never moves existing ones
+
+    for (U32 i = 1; i < 3000; i++)
+    {
+      registry.Emplace<TestName>(entities[i], "entity" + std::to_string(i));
+    }
+
+    TEST_CHECK(State, registry.GetPool<TestName>().GetCount() == 3000);
+    TEST_CHECK(State, registry.Get<TestName>(entities[0]) == firstName);
+    TEST_CHECK(State, firstName->Value == "entity0");
+
+    // Removing moves the last component into the hole and keeps every lookup intact
+
+    for (U32 i = 0; i < 3000; i += 3)
+    {
+      registry.Remove<TestName>(entities[i]);
+    }
+
+    U32 matching = 0;
+
+    for (U32 i = 0; i < 3000; i++)
+    {
+      TestName* name = registry.Get<TestName>(entities[i]);
+
+      matching += (i % 3) ? (name && name->Value == "entity" + std::to_string(i)) : (name == nullptr);
+    }
+
+    TEST_CHECK(State, registry.GetPool<TestName>().GetCount() == 2000);
+    TEST_CHECK(State, matching == 3000);
+  } };
+
+  static Test sRegistryEach = { "Registry::Each/Intersection", [](TestState& State)
+  {
+    Registry registry = {};
+
+    for (U32 i = 0; i < 100; i++)
+    {
+      Entity entity = registry.CreateEntity();
+
+      registry.Emplace<TestPosition>(entity, i);
+
+      if (i % 4 == 0)
+      {
+        registry.Emplace<TestName>(entity, std::to_string(i));
+      }
+    }
+
+    U32 positionCount = 0;
+    U32 positionSum = 0;
+
+    registry.Each<TestPosition>([&](TestPosition& Position)
+    {
+      positionCount++;
+      positionSum += Position.Value;
+    });
+
+    U32 bothCount = 0;
+    U32 bothMatching = 0;
+
+    registry.Each<TestPosition, TestName>([&](TestPosition& Position, TestName& Name)
+    {
+      bothCount++;
+      bothMatching += Name.Value == std::to_string(Position.Value);
+    });
+
+    TEST_CHECK(State, positionCount == 100 && positionSum == 4950);
+    TEST_CHECK(State, bothCount == 25 && bothMatching == 25);
+  } };
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <Editor/Renderer/RenderQueue.h>
+
+#include <Tests/Test.h>
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static const Transform* MakeTag(U32 Index)
+  {
+    // Tasks are told apart by their transform pointer, it is never dereferenced
+
+    return (const Transform*)(U64)(Index + 1);
+  }
+
+  static U32 GetTag(const RenderTask& RenderTask)
+  {
+    return (U32)(U64)RenderTask.TransformPtr - 1;
+  }
+}
+
+///////////////////////////////////////////////////////////
+// Tests
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static Test sRenderQueueSort = { "RenderQueue::Sort/Stable", [](TestState& State)
+  {
+    std::mt19937 generator = std::mt19937{ 38 };
+
+    RenderQueue renderQueue = {};
+
+    // Two frames through the same queue, the second one reuses the storage of the first
+
+    for (U32 frame = 0; frame < 2; frame++)
+    {
+      std::vector<U64> keys = {};
+
+      for (U32 i = 0; i < 5000; i++)
+      {
+        // Few distinct high bytes so equal keys show up and skipped passes get exercised
+
+        keys.emplace_back(((U64)(generator() % 4) << 56) | ((U64)(generator() % 64) << 32) | (generator() % 3));
+
+        renderQueue.Push(RenderTask{ MakeTag(i), nullptr, nullptr });
+      }
+
+      renderQueue.Sort([&](const RenderTask& RenderTask) { return keys[GetTag(RenderTask)]; });
+
+      std::vector<std::pair<U64, U32>> expected = {};
+
+      for (U32 i = 0; i < keys.size(); i++)
+      {
+        expected.emplace_back(keys[i], i);
+      }
+
+      std::stable_sort(expected.begin(), expected.end(), [](const auto& A, const auto& B) { return A.first < B.first; });
+
+      U32 matching = 0;
+
+      for (U32 i = 0; i < renderQueue.GetCount(); i++)
+      {
+        matching += renderQueue.GetKey(i) == expected[i].first && GetTag(renderQueue.GetTask(i)) == expected[i].second;
+      }
+
+      TEST_CHECK(State, renderQueue.GetCount() == keys.size());
+      TEST_CHECK(State, matching == keys.size());
+
+      renderQueue.Clear();
+
+      TEST_CHECK(State, renderQueue.GetCount() == 0);
+    }
+
+    renderQueue.Sort([](const RenderTask&) { return 0ULL; });
+
+    TEST_CHECK(State, renderQueue.GetCount() == 0);
+  } };
+
+  static Test sRenderQueueMakeKey = { "RenderQueue::MakeKey/Order", [](TestState& State)
+  {
+    // Opaque before transparent, then shader, texture and mesh, then depth
+
+    TEST_CHECK(State, RenderQueue::MakeKey(eRenderPassOpaque, 63, 4095, 4095, 1000.0F) < RenderQueue::MakeKey(eRenderPassTransparent, 0, 0, 0, 0.0F));
+    TEST_CHECK(State, RenderQueue::MakeKey(eRenderPassOpaque, 1, 0, 0, 1000.0F) < RenderQueue::MakeKey(eRenderPassOpaque, 2, 0, 0, 0.0F));
+    TEST_CHECK(State, RenderQueue::MakeKey(eRenderPassOpaque, 1, 3, 9, 1000.0F) < RenderQueue::MakeKey(eRenderPassOpaque, 1, 4, 0, 0.0F));
+    TEST_CHECK(State, RenderQueue::MakeKey(eRenderPassOpaque, 1, 3, 8, 1000.0F) < RenderQueue::MakeKey(eRenderPassOpaque, 1, 3, 9, 0.0F));
+
+    // Opaque front to back, transparent back to front, negative depth clamps to zero
+
+    TEST_CHECK(State, RenderQueue::MakeKey(eRenderPassOpaque, 1, 2, 3, 1.5F) < RenderQueue::MakeKey(eRenderPassOpaque, 1, 2, 3, 200.0F));
+    TEST_CHECK(State, RenderQueue::MakeKey(eRenderPassTransparent, 1, 2, 3, 200.0F) < RenderQueue::MakeKey(eRenderPassTransparent, 1, 2, 3, 1.5F));
+    TEST_CHECK(State, RenderQueue::MakeKey(eRenderPassOpaque, 1, 2, 3, -5.0F) == RenderQueue::MakeKey(eRenderPassOpaque, 1, 2, 3, 0.0F));
+  } };
+}
\ No newline at end of file
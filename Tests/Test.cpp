@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#include <Common/Debug.h>
+
+#include <Tests/Test.h>
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+static constexpr const char* sOptions[] = { "--filter" };
+
+static void PrintUsage()
+{
+  LOG("Usage: Tests [--filter <text>]\n");
+}
+
+///////////////////////////////////////////////////////////
+// Implementation
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  bool TestState::Check(bool Condition, const char* Expression, const char* File, U32 Line)
+  {
+    mChecks++;
+
+    if (!Condition)
+    {
+      mFailures++;
+
+      LOG_ERROR("%s:%u: Check failed: %s\n", File, Line, Expression);
+    }
+
+    return Condition;
+  }
+
+  Test::Test(const char* Name, std::function<void(TestState&)> Function)
+    : mName{ Name }
+    , mFunction{ std::move(Function) }
+  {
+    GetTests().emplace_back(this);
+  }
+
+  std::vector<Test*>& Test::GetTests()
+  {
+    static std::vector<Test*> sTests = {};
+
+    return sTests;
+  }
+
+  TestState Test::Run()
+  {
+    TestState state = {};
+
+    mFunction(state);
+
+    return state;
+  }
+}
+
+///////////////////////////////////////////////////////////
+// Entry Point
+///////////////////////////////////////////////////////////
+
+ark::I32 main(ark::I32 Argc, char** Argv)
+{
+  std::string filter = {};
+
+  for (ark::I32 i = 1; i < Argc; i++)
+  {
+    const char* option = Argv[i];
+    const char* value = ((i + 1) < Argc) ? Argv[i + 1] : nullptr;
+
+    if (std::strcmp(option, "--help") == 0)
+    {
+      PrintUsage();
+
+      return 0;
+    }
+
+    if (std::none_of(std::begin(sOptions), std::end(sOptions), [&](const char* Name) { return std::strcmp(option, Name) == 0; }))
+    {
+      LOG("Unknown option %s\n", option);
+
+      PrintUsage();
+
+      return 2;
+    }
+
+    if (!value)
+    {
+      LOG("Missing value for %s\n", option);
+
+      return 2;
+    }
+
+    if (std::strcmp(option, "--filter") == 0) filter = value;
+
+    i++;
+  }
+
+  ark::U32 testCount = 0;
+  ark::U32 failedCount = 0;
+
+  for (auto test : ark::Test::GetTests())
+  {
+    if (std::string{ test->GetName() }.find(filter) == std::string::npos)
+    {
+      continue;
+    }
+
+    ark::TestState state = test->Run();
+
+    LOG("%-60s %s (%u checks)\n", test->GetName(), state.GetFailures() ? "FAILED" : "passed", state.GetChecks());
+
+    testCount++;
+    failedCount += state.GetFailures() ? 1 : 0;
+  }
+
+  LOG("%u of %u tests passed\n", testCount - failedCount, testCount);
+
+  ark::Logger::Flush();
+
+  return failedCount ? 1 : 0;
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <functional>
+
+#include <Common/Types.h>
+
+///////////////////////////////////////////////////////////
+// Definition
+///////////////////////////////////////////////////////////
+
+#define TEST_CHECK(STATE, EXPRESSION) (STATE).Check((EXPRESSION), #EXPRESSION, __FILE__, __LINE__)
+
+namespace ark
+{
+  /*
+   * Outcome of a single test.
+   *
+   * Failed checks are logged with their expression and location as they happen,
+   * the test keeps running so one run reports every broken expectation.
+   */
+  class TestState
+  {
+  public:
+
+    inline auto GetChecks() const { return mChecks; }
+    inline auto GetFailures() const { return mFailures; }
+
+  public:
+
+    bool Check(bool Condition, const char* Expression, const char* File, U32 Line);
+
+  private:
+
+    U32 mChecks = 0;
+    U32 mFailures = 0;
+  };
+
+  /*
+   * Self registering test.
+   *
+   * Every instance adds itself to a global list at static initialization time, so
+   * tests are declared as file scope statics, one file per unit under test.
+   */
+  class Test
+  {
+  public:
+
+    Test(const char* Name, std::function<void(TestState&)> Function);
+
+  public:
+
+    static std::vector<Test*>& GetTests();
+
+  public:
+
+    inline auto GetName() const { return mName; }
+
+  public:
+
+    TestState Run();
+
+  private:
+
+    const char* mName;
+
+    std::function<void(TestState&)> mFunction;
+  };
+}
\ No newline at end of file
@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <Common/BlowFish.h>
+#include <Common/VirtualFileSystem.h>
+
+#include <Common/Trees/ArchiveNode.h>
+
+#include <Common/Utils/FileUtils.h>
+
+#include <Generator/Dataset.h>
+
+#include <Tests/Test.h>
+
+///////////////////////////////////////////////////////////
+// Locals
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static const std::string sEncryptionKey = "YaKiNiKuM2rrVrPJpGMkfe3EK4RbpbHw";
+
+  static const char* sSources = R"({ "levels": [ { "sourceDir": "st1", "unpackDir": "1", "extensions": [ ".dat" ], "selectExpr": "XXXX" } ] })";
+
+  static fs::path BuildArchives(const std::string& Name, const std::vector<std::string>& Levels)
+  {
+    fs::path dir = fs::temp_directory_path() / "NipponTests" / Name;
+
+    fs::remove_all(dir);
+    fs::create_directories(dir / "data_pc" / "st1");
+    fs::create_directories(dir / "unpack");
+
+    DatasetLevel datasetLevel = {};
+
+    datasetLevel.ModelCount = 6;
+    datasetLevel.ObjectCount = 32;
+    datasetLevel.TextureCount = 4;
+    datasetLevel.TextureSize = 128;
+    datasetLevel.FillerCount = 16;
+
+    BlowFish cypher = { sEncryptionKey };
+
+    for (U32 i = 0; i < Levels.size(); i++)
+    {
+      std::vector<U8> bytes = Dataset::Level(Levels[i], datasetLevel, 43 + i);
+
+      // Encryption works on whole blocks of eight bytes, the reference extraction runs on the same padded bytes
+
+      bytes.resize((bytes.size() + 7) / 8 * 8, 0);
+
+      fs::create_directories(dir / "unpack" / Levels[i]);
+
+      ArchiveNode{ bytes }.ExtractRecursive(dir / "unpack" / Levels[i]);
+
+      cypher.Encrypt(bytes);
+
+      FileUtils::WriteBinary((dir / "data_pc" / "st1" / (Levels[i] + ".dat")).string(), bytes);
+    }
+
+    return dir;
+  }
+
+  static std::vector<std::string> ListExtracted(const fs::path& Dir)
+  {
+    std::vector<std::string> names = {};
+
+    for (const auto& file : fs::directory_iterator{ Dir })
+    {
+      names.emplace_back(file.path().filename().string());
+    }
+
+    std::sort(names.begin(), names.end());
+
+    return names;
+  }
+}
+
+///////////////////////////////////////////////////////////
+// Tests
+///////////////////////////////////////////////////////////
+
+namespace ark
+{
+  static Test sVirtualFileSystemExtraction = { "VirtualFileSystem::ReadBinary/Extraction", [](TestState& State)
+  {
+    std::vector<std::string> levels = { "r100", "r101" };
+
+    fs::path dir = BuildArchives("VirtualFileSystem", levels);
+
+    rj::Document sources = {};
+
+    sources.Parse(sSources);
+
+    // A cache of two blocks keeps evicting while the archives are walked
+
+    VirtualFileSystem virtualFileSystem = { 2 * VirtualFileSystem::sBlockSize };
+
+    TEST_CHECK(State, virtualFileSystem.MountArchives(dir / "data_pc", sEncryptionKey, sources) == levels.size());
+
+    for (const auto& level : levels)
+    {
+      fs::path unpackDir = dir / "unpack" / level;
+
+      std::vector<std::string> names = ListExtracted(unpackDir);
+
+      TEST_CHECK(State, !names.empty());
+      TEST_CHECK(State, virtualFileSystem.List(fs::path{ "levels" } / "1" / level) == names);
+
+      U32 matching = 0;
+
+      for (const auto& name : names)
+      {
+        matching += virtualFileSystem.ReadBinary(fs::path{ "levels" } / "1" / level / name) == FileUtils::ReadBinary((unpackDir / name).string());
+      }
+
+      TEST_CHECK(State, matching == names.size());
+    }
+
+    TEST_CHECK(State, virtualFileSystem.GetCacheMisses() > 0);
+    TEST_CHECK(State, !virtualFileSystem.Exists("levels/1/r100/missing.SCR"));
+    TEST_CHECK(State, virtualFileSystem.ReadBinary("levels/1/r102/missing.SCR").empty());
+
+    fs::remove_all(dir);
+  } };
+
+  static Test sVirtualFileSystemOverride = { "VirtualFileSystem::ReadBinary/Override", [](TestState& State)
+  {
+    fs::path dir = BuildArchives("VirtualFileSystemOverride", { "r100" });
+
+    rj::Document sources = {};
+
+    sources.Parse(sSources);
+
+    VirtualFileSystem virtualFileSystem = {};
+
+    virtualFileSystem.MountArchives(dir / "data_pc", sEncryptionKey, sources);
+
+    std::string name = ListExtracted(dir / "unpack" / "r100").front();
+    std::vector<U8> bytes = { 1, 2, 3, 4 };
+
+    // Files of a mounted directory shadow archive entries of the same path
+
+    fs::create_directories(dir / "mods" / "levels" / "1" / "r100");
+
+    FileUtils::WriteBinary((dir / "mods" / "levels" / "1" / "r100" / name).string(), bytes);
+
+    virtualFileSystem.MountDirectory(dir / "mods");
+
+    TEST_CHECK(State, virtualFileSystem.Exists(fs::path{ "levels" } / "1" / "r100" / name));
+    TEST_CHECK(State, virtualFileSystem.ReadBinary(fs::path{ "levels" } / "1" / "r100" / name) == bytes);
+    TEST_CHECK(State, virtualFileSystem.List("levels/1/r100") == ListExtracted(dir / "unpack" / "r100"));
+
+    fs::remove_all(dir);
+  } };
+}
\ No newline at end of file